@@ -0,0 +1,70 @@
+/************************************************************
+ * @file bench_render.cpp
+ * @brief Замер программной отрисовки кадра 8K
+ *
+ * Рисует каркас сферы из 2 млн ребер при разных размерах плиток. Одна
+ *плитка на весь кадр растеризуется одним потоком и служит точкой отсчета
+ *для параллельной отрисовки по плиткам.
+ ************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "../render/rasterizer.hpp"
+
+namespace {
+
+constexpr int kRings = 1000;
+constexpr int kWidth = 7680;
+constexpr int kHeight = 4320;
+constexpr int kRepeats = 3;
+
+template <typename F>
+double measure(F&& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRepeats; i++) f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count() /
+         kRepeats;
+}
+
+}  // namespace
+
+int main() {
+  // Сфера из kRings колец по kRings вершин: ребра к соседям по кольцу и
+  // по меридиану, как у полигональной модели
+  s21::Object object;
+  object.vertexes.reserve(kRings * kRings);
+  for (int ring = 0; ring < kRings; ring++) {
+    double theta = M_PI * (ring + 0.5) / kRings;
+    for (int i = 0; i < kRings; i++) {
+      double phi = 2 * M_PI * i / kRings;
+      object.vertexes.emplace_back(0.9 * std::sin(theta) * std::cos(phi),
+                                   0.9 * std::sin(theta) * std::sin(phi),
+                                   0.9 * std::cos(theta));
+    }
+  }
+  for (int ring = 0; ring < kRings; ring++) {
+    for (int i = 0; i < kRings; i++) {
+      int at = ring * kRings + i;
+      object.lines.push_back({at, ring * kRings + (i + 1) % kRings});
+      if (ring + 1 < kRings) object.lines.push_back({at, at + kRings});
+    }
+  }
+  object.edges.build(object.lines, object.vertexes.size());
+  s21::RenderStyle style;
+  style.parallel_projection = false;
+  s21::Matrix4 model = s21::Matrix4::fromMovement(s21::RotateX, 0.5);
+
+  s21::Image image(kWidth, kHeight);
+  for (int tile_size : {kWidth, 256, 128, 64}) {
+    s21::Rasterizer rasterizer(tile_size);
+    double time =
+        measure([&] { rasterizer.render(object, model, style, image); });
+    std::printf("tile %5d  %8.2f ms  (%08x)\n", tile_size, time,
+                image.rgba(kWidth / 2, kHeight / 2));
+  }
+  return 0;
+}
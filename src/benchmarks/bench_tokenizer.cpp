@@ -0,0 +1,121 @@
+/************************************************************
+ * @file bench_tokenizer.cpp
+ * @brief Замер стоимости разбора одной строки obj файла
+ *
+ * Сравнивает прежний разбор через строковые потоки с Tokenizer и считает
+ *выделения памяти на одну запись.
+ ************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../parser/tokenizer.hpp"
+
+namespace {
+
+std::size_t allocations = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations++;
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr int kLines = 1000000;
+
+/************************************************************
+ * @brief Прежний разбор вершины через std::istringstream
+ ************************************************************/
+double streamVertex(const std::string& line) {
+  std::istringstream iss(line);
+  std::string symbol{};
+  double x = 0, y = 0, z = 0;
+  iss >> symbol >> x >> y >> z;
+  return x + y + z;
+}
+
+/************************************************************
+ * @brief Прежний разбор полигона через std::stringstream
+ ************************************************************/
+int streamFace(const std::string& line) {
+  std::stringstream iss(line);
+  std::string symbol{};
+  std::string word{};
+  iss >> symbol;
+  iss.ignore();
+  int sum = 0;
+  while (std::getline(iss, word, ' ')) {
+    std::stringstream iss2(word);
+    double point{};
+    iss2 >> point;
+    sum += static_cast<int>(point);
+  }
+  return sum;
+}
+
+double tokenVertex(std::string_view line) {
+  s21::Tokenizer tokens(line);
+  tokens.readToken();
+  double x = 0, y = 0, z = 0;
+  tokens.readDouble(x) && tokens.readDouble(y) && tokens.readDouble(z);
+  return x + y + z;
+}
+
+int tokenFace(std::string_view line) {
+  s21::Tokenizer tokens(line);
+  tokens.readToken();
+  int sum = 0;
+  s21::FaceIndex index;
+  while (!tokens.atEnd()) {
+    if (tokens.readFaceIndex(index)) sum += index.vertex;
+  }
+  return sum;
+}
+
+template <typename F>
+void measure(const char* name, const std::vector<std::string>& lines, F&& f) {
+  double sink = 0;
+  std::size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (const std::string& line : lines) sink += f(line);
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-16s %8.1f ns/line %6.2f allocs/line (checksum %g)\n", name,
+              ns / lines.size(),
+              static_cast<double>(allocations - before) / lines.size(), sink);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::string> vertexes;
+  std::vector<std::string> faces;
+  vertexes.reserve(kLines);
+  faces.reserve(kLines);
+  for (int i = 0; i < kLines; i++) {
+    vertexes.push_back("v " + std::to_string(i * 0.001) + " -" +
+                       std::to_string(i % 97) + ".125 3.5e-2");
+    faces.push_back("f " + std::to_string(i + 1) + "/1/1 " +
+                    std::to_string(i + 2) + "//2 -3/4/5 " +
+                    std::to_string(i + 4));
+  }
+
+  measure("stream vertex", vertexes, streamVertex);
+  measure("tokenizer vertex", vertexes, tokenVertex);
+  measure("stream face", faces, streamFace);
+  measure("tokenizer face", faces, tokenFace);
+  return 0;
+}
@@ -0,0 +1,111 @@
+/************************************************************
+ * @file bench_transform.cpp
+ * @brief Замер преобразований модели на 10 млн вершин
+ *
+ * Сравнивает прежние циклы transformation.cpp по массиву Point (с sin и cos
+ *внутри цикла) с ядрами kernels.hpp для каждого набора инструкций,
+ *который поддерживает процессор.
+ ************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "../object/object.hpp"
+#include "../transformation/kernels.hpp"
+
+namespace {
+
+constexpr std::size_t kVertexes = 10000000;
+constexpr int kRepeats = 5;
+
+/************************************************************
+ * @brief Прежний поворот вокруг оси X
+ ************************************************************/
+void legacyRotateX(std::vector<s21::Point>& vertexes, double angle) {
+  for (s21::Point& p : vertexes) {
+    double tmpY = p.y;
+    p.y = p.y * std::cos(angle) - p.z * std::sin(angle);
+    p.z = tmpY * std::sin(angle) + p.z * std::cos(angle);
+  }
+}
+
+/************************************************************
+ * @brief Прежнее перемещение по оси X
+ ************************************************************/
+void legacyMoveX(std::vector<s21::Point>& vertexes, double step) {
+  for (s21::Point& p : vertexes) {
+    p.x += step;
+  }
+}
+
+/************************************************************
+ * @brief Прежнее масштабирование
+ ************************************************************/
+void legacyScale(std::vector<s21::Point>& vertexes, double scal) {
+  for (s21::Point& p : vertexes) {
+    p.x *= scal;
+    p.y *= scal;
+    p.z *= scal;
+  }
+}
+
+double sampleY(std::size_t i) { return -static_cast<double>(i % 97) * 0.5; }
+
+template <typename F>
+double measure(F&& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRepeats; i++) f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count() /
+         kRepeats;
+}
+
+void report(const char* name, double move, double rotate, double scale,
+            double checksum) {
+  std::printf("%-8s move %7.2f ms  rotate %7.2f ms  scale %7.2f ms  (%g)\n",
+              name, move, rotate, scale, checksum);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<s21::Point> points(kVertexes);
+  for (std::size_t i = 0; i < kVertexes; i++) {
+    points[i] = s21::Point(i * 1e-6, sampleY(i), 3.5e-2);
+  }
+  double angle = 0.3 * M_PI / 180;
+
+  double move = measure([&] { legacyMoveX(points, 0.01); });
+  double rotate = measure([&] { legacyRotateX(points, angle); });
+  double scale = measure([&] { legacyScale(points, 1.0001); });
+  report("legacy", move, rotate, scale, points[kVertexes / 2].y);
+
+  const char* names[] = {"scalar", "sse2", "avx2", "avx512"};
+  for (s21::SimdLevel level :
+       {s21::SimdLevel::kScalar, s21::SimdLevel::kSse2, s21::SimdLevel::kAvx2,
+        s21::SimdLevel::kAvx512}) {
+    if (level > s21::detectSimdLevel()) break;
+    const s21::TransformKernels& kernels = s21::kernelsFor(level);
+    s21::VertexArray vertexes;
+    vertexes.reserve(kVertexes);
+    for (std::size_t i = 0; i < kVertexes; i++) {
+      vertexes.emplace_back(i * 1e-6, sampleY(i), 3.5e-2);
+    }
+    s21::Scalar c = static_cast<s21::Scalar>(std::cos(angle));
+    s21::Scalar s = static_cast<s21::Scalar>(std::sin(angle));
+    move = measure([&] { kernels.translate(vertexes.x(), kVertexes, 0.01); });
+    rotate = measure([&] {
+      kernels.rotate(vertexes.y(), vertexes.z(), kVertexes, c, s);
+    });
+    scale = measure([&] {
+      for (s21::Scalar* axis : {vertexes.x(), vertexes.y(), vertexes.z()}) {
+        kernels.scale(axis, kVertexes, static_cast<s21::Scalar>(1.0001));
+      }
+    });
+    report(names[static_cast<int>(level)], move, rotate, scale,
+           vertexes.y()[kVertexes / 2]);
+  }
+  return 0;
+}
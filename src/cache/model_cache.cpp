@@ -0,0 +1,224 @@
+#include "model_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "../parser/mapped_file.hpp"
+
+/************************************************************
+ * @file model_cache.cpp
+ * @brief Бинарный кэш разобранных obj файлов
+ ************************************************************/
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'M', 'O', 'D', 'E', 'L'};
+constexpr std::uint32_t kVersion = 5;
+
+/************************************************************
+ * @brief Сведения об исходном файле, по которым проверяется кэш
+ ************************************************************/
+struct SourceInfo {
+  std::string path;
+  std::uint64_t size = 0;
+  std::int64_t mtime = 0;
+};
+
+bool readSourceInfo(const std::string& source, SourceInfo& info) {
+  std::error_code error;
+  fs::path path = fs::weakly_canonical(fs::absolute(source, error), error);
+  if (error) return false;
+  info.size = fs::file_size(path, error);
+  if (error) return false;
+  auto mtime = fs::last_write_time(path, error);
+  if (error) return false;
+  info.path = path.string();
+  info.mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+  return true;
+}
+
+std::size_t padded(std::size_t size) { return (size + 7) / 8 * 8; }
+
+/************************************************************
+ * @brief Через сколько 8-байтовых слов хэширование проверяет отмену
+ ************************************************************/
+constexpr std::size_t kCancelCheckWords = std::size_t{1} << 20;
+
+bool isCancelled(const std::atomic<bool>* cancelled) {
+  return cancelled != nullptr && cancelled->load();
+}
+
+template <typename T>
+void writeArray(std::ofstream& file, const T* data, std::size_t count) {
+  file.write(reinterpret_cast<const char*>(data),
+             static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+}  // namespace
+
+s21::ModelCache::ModelCache(std::string directory)
+    : directory_{std::move(directory)} {}
+
+std::uint64_t s21::ModelCache::hash(std::string_view data,
+                                     const std::atomic<bool>* cancelled) {
+  constexpr std::uint64_t kMul = 0x9E3779B97F4A7C15ull;
+  std::uint64_t h = 0xcbf29ce484222325ull ^ (data.size() * kMul);
+  const char* it = data.data();
+  std::size_t words = data.size() / 8;
+  for (std::size_t i = 0; i < words; i++, it += 8) {
+    if (i % kCancelCheckWords == 0 && isCancelled(cancelled)) return 0;
+    std::uint64_t word;
+    std::memcpy(&word, it, 8);
+    h = (h ^ word) * kMul;
+    h ^= h >> 32;
+  }
+  for (std::size_t i = words * 8; i < data.size(); i++, it++) {
+    h = (h ^ static_cast<unsigned char>(*it)) * 0x100000001b3ull;
+  }
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+std::string s21::ModelCache::cachePath(const std::string& source) const {
+  std::error_code error;
+  std::string path =
+      fs::weakly_canonical(fs::absolute(source, error), error).string();
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.s21cache",
+                static_cast<unsigned long long>(hash(path)));
+  return (fs::path(directory_) / name).string();
+}
+
+bool s21::ModelCache::load(const std::string& source, Object& object,
+                           bool verify_content) const {
+  SourceInfo info;
+  if (!readSourceInfo(source, info)) return false;
+  MappedFile file(cachePath(source));
+  if (!file.is_open() || file.size() < sizeof(CacheHeader)) return false;
+
+  CacheHeader header;
+  std::memcpy(&header, file.data(), sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion || header.scalar_size != sizeof(Scalar) ||
+      header.source_size != info.size ||
+      header.source_mtime != info.mtime ||
+      header.path_length != info.path.size()) {
+    return false;
+  }
+  const char* it = file.data() + sizeof(header);
+  if (std::string_view(it, header.path_length) != info.path) return false;
+  it += padded(header.path_length);
+
+  std::size_t expected = sizeof(header) + padded(header.path_length) +
+                         header.vertex_count * 3 * sizeof(Scalar) +
+                         (header.face_count + 1) * sizeof(std::uint64_t) +
+                         header.index_count * sizeof(std::int32_t) +
+                         header.open_count;
+  if (file.size() != expected ||
+      (header.open_count != 0 && header.open_count != header.face_count)) {
+    return false;
+  }
+  if (verify_content) {
+    MappedFile content(info.path);
+    if (!content.is_open() || hash(content.view()) != header.content_hash) {
+      return false;
+    }
+  }
+
+  object.vertexes.clear();
+  object.lines.clear();
+  object.vertexes.resize(header.vertex_count);
+  std::size_t coordinates = header.vertex_count * sizeof(Scalar);
+  for (Scalar* axis : {object.vertexes.x(), object.vertexes.y(),
+                       object.vertexes.z()}) {
+    std::memcpy(axis, it, coordinates);
+    it += coordinates;
+  }
+  std::vector<std::uint64_t> offsets(header.face_count + 1);
+  std::memcpy(offsets.data(), it, offsets.size() * sizeof(std::uint64_t));
+  it += offsets.size() * sizeof(std::uint64_t);
+  // Границы каждого полигона берутся из соседних элементов, поэтому
+  // проверяется весь массив, а не только его концы
+  if (offsets.front() != 0 || offsets.back() != header.index_count ||
+      !std::is_sorted(offsets.begin(), offsets.end())) {
+    object.vertexes.clear();
+    return false;
+  }
+  std::vector<int> indexes(header.index_count);
+  std::memcpy(indexes.data(), it, indexes.size() * sizeof(std::int32_t));
+  it += indexes.size() * sizeof(std::int32_t);
+  std::vector<std::uint8_t> open(it, it + header.open_count);
+  // Снимок записывается после проверки индексов, поэтому индекс вне
+  // модели означает поврежденный файл
+  std::size_t vertex_count = header.vertex_count;
+  auto outside = [vertex_count](int i) {
+    return i < 0 || static_cast<std::size_t>(i) >= vertex_count;
+  };
+  if (std::any_of(indexes.begin(), indexes.end(), outside)) {
+    object.vertexes.clear();
+    return false;
+  }
+  object.lines.assign(std::move(offsets), std::move(indexes), std::move(open));
+  return true;
+}
+
+bool s21::ModelCache::store(const std::string& source, const Object& object,
+                            const std::atomic<bool>* cancelled) const {
+  SourceInfo info;
+  if (!readSourceInfo(source, info)) return false;
+  MappedFile content(info.path);
+  if (!content.is_open()) return false;
+
+  CacheHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.scalar_size = sizeof(Scalar);
+  header.path_length = static_cast<std::uint32_t>(info.path.size());
+  header.source_size = info.size;
+  header.source_mtime = info.mtime;
+  header.content_hash = hash(content.view(), cancelled);
+  if (isCancelled(cancelled)) return false;
+  header.vertex_count = object.vertexes.size();
+  header.face_count = object.lines.size();
+  header.index_count = object.lines.indexCount();
+  const std::uint8_t* open = object.lines.openFlags();
+  header.open_count = open != nullptr ? header.face_count : 0;
+
+  std::error_code error;
+  fs::create_directories(directory_, error);
+  std::string path = cachePath(source);
+  std::string temp = path + ".tmp";
+  {
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::string name = info.path;
+    name.resize(padded(name.size()), '\0');
+    file.write(name.data(), static_cast<std::streamsize>(name.size()));
+    for (const Scalar* axis : {object.vertexes.x(), object.vertexes.y(),
+                               object.vertexes.z()}) {
+      if (isCancelled(cancelled)) break;
+      writeArray(file, axis, object.vertexes.size());
+    }
+    writeArray(file, object.lines.offsets(), object.lines.size() + 1);
+    writeArray(file, object.lines.indexes(), object.lines.indexCount());
+    writeArray(file, open, header.open_count);
+    if (!file || isCancelled(cancelled)) {
+      fs::remove(temp, error);
+      return false;
+    }
+  }
+  fs::rename(temp, path, error);
+  return !error;
+}
@@ -0,0 +1,102 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_CACHE_MODEL_CACHE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_CACHE_MODEL_CACHE_HPP_
+
+/************************************************************
+ * @file model_cache.hpp
+ * @brief Бинарный кэш разобранных obj файлов
+ ************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../object/object.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Заголовок файла кэша
+ *
+ * За заголовком следуют путь до исходного файла (path_length байт,
+ *выровнено до 8), координаты вершин (массивы x, y и z по vertex_count чисел
+ *размером scalar_size байт), границы полигонов (face_count + 1 uint64),
+ *индексы вершин (index_count int32) в том же виде, что и в FaceArray:
+ *от нуля и уже проверенные, и флаги открытых ломаных (open_count байт:
+ *0, если ломаных нет, иначе face_count).
+ ************************************************************/
+struct CacheHeader {
+  char magic[8];
+  std::uint16_t version;
+  std::uint16_t scalar_size;
+  std::uint32_t path_length;
+  std::uint64_t source_size;
+  std::int64_t source_mtime;
+  std::uint64_t content_hash;
+  std::uint64_t vertex_count;
+  std::uint64_t face_count;
+  std::uint64_t index_count;
+  std::uint64_t open_count;
+};
+
+/************************************************************
+ * @brief Класс для сохранения и загрузки модели в бинарном виде
+ *
+ * После первого разбора obj файла модель сохраняется в каталог кэша. При
+ *следующем открытии того же файла кэш отображается в память и копируется
+ *в Object целыми массивами, без разбора текста. Кэш считается
+ *действительным, если совпадают путь, размер и время изменения исходного
+ *файла; по запросу дополнительно сверяется хэш содержимого.
+ ************************************************************/
+class ModelCache {
+ public:
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param directory Каталог, в котором хранятся файлы кэша
+   ************************************************************/
+  explicit ModelCache(std::string directory);
+
+  /************************************************************
+   * @brief Метод для получения пути до файла кэша
+   * @param source Путь до obj файла
+   * @return Путь до файла кэша
+   ************************************************************/
+  std::string cachePath(const std::string& source) const;
+
+  /************************************************************
+   * @brief Метод для загрузки модели из кэша
+   * @param source Путь до obj файла
+   * @param object Объект, в который загружается модель
+   * @param verify_content Сверять ли хэш содержимого исходного файла
+   * @return true, если найден действительный кэш
+   ************************************************************/
+  bool load(const std::string& source, Object& object,
+            bool verify_content = false) const;
+
+  /************************************************************
+   * @brief Метод для сохранения модели в кэш
+   * @param source Путь до obj файла, из которого получена модель
+   * @param object Разобранная модель
+   * @param cancelled Флаг отмены, который проверяется во время хэширования
+   *и записи, может быть nullptr
+   * @return true, если кэш записан
+   ************************************************************/
+  bool store(const std::string& source, const Object& object,
+             const std::atomic<bool>* cancelled = nullptr) const;
+
+  /************************************************************
+   * @brief Функция хэширования содержимого файла
+   * @param data Содержимое
+   * @param cancelled Флаг отмены, проверяется через каждые 8 МБ
+   * @return 64-битный хэш или 0, если хэширование отменено
+   ************************************************************/
+  static std::uint64_t hash(std::string_view data,
+                            const std::atomic<bool>* cancelled = nullptr);
+
+ private:
+  std::string directory_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_CACHE_MODEL_CACHE_HPP_
@@ -0,0 +1,112 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_BOUNDED_QUEUE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_BOUNDED_QUEUE_HPP_
+
+/************************************************************
+ * @file bounded_queue.hpp
+ * @brief Очередь ограниченной длины для передачи данных между потоками
+ ************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Очередь ограниченной длины
+ *
+ * Производитель ждет в push, пока в очереди нет места, поэтому быстрый
+ *производитель замедляется до скорости потребителя, а элементы не
+ *теряются и память не растет. tryPush не ждет и позволяет потоку
+ *интерфейса повторить попытку позже.
+ ************************************************************/
+template <typename T>
+class BoundedQueue {
+ public:
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param capacity Наибольшее число элементов, не меньше 1
+   ************************************************************/
+  explicit BoundedQueue(std::size_t capacity)
+      : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+  BoundedQueue(const BoundedQueue& other) = delete;
+  BoundedQueue& operator=(const BoundedQueue& other) = delete;
+
+  /************************************************************
+   * @brief Метод для добавления элемента с ожиданием места
+   * @return false, если очередь закрыта
+   ************************************************************/
+  bool push(T item) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock,
+                   [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) return false;
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /************************************************************
+   * @brief Метод для добавления элемента без ожидания
+   * @details item перемещается в очередь только при успехе
+   * @return false, если очередь полна или закрыта
+   ************************************************************/
+  bool tryPush(T& item) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || items_.size() >= capacity_) return false;
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /************************************************************
+   * @brief Метод для извлечения элемента с ожиданием
+   * @return Элемент или пустое значение, если очередь закрыта и пуста
+   ************************************************************/
+  std::optional<T> pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) return std::nullopt;
+    std::optional<T> item(std::move(items_.front()));
+    items_.pop_front();
+    not_full_.notify_one();
+    return item;
+  }
+
+  /************************************************************
+   * @brief Метод для закрытия очереди
+   *
+   * Новые элементы больше не принимаются, ожидающие push возвращают
+   *false, а pop отдает оставшиеся элементы и затем пустое значение.
+   * @return void
+   ************************************************************/
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return items_.size();
+  }
+  std::size_t capacity() const { return capacity_; }
+
+ private:
+  const std::size_t capacity_;
+  std::deque<T> items_;
+  mutable std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  bool closed_ = false;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_BOUNDED_QUEUE_HPP_
@@ -0,0 +1,58 @@
+#include "export_worker.hpp"
+
+#include <optional>
+#include <utility>
+
+/************************************************************
+ * @file export_worker.cpp
+ * @brief Фоновое кодирование и запись снимков и анимаций
+ ************************************************************/
+
+s21::ExportWorker::ExportWorker(std::size_t capacity)
+    : queue_(capacity), thread_(&ExportWorker::workerLoop, this) {}
+
+s21::ExportWorker::~ExportWorker() {
+  queue_.close();
+  thread_.join();
+}
+
+void s21::ExportWorker::submit(ExportTask task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_++;
+  }
+  if (!queue_.push(std::move(task))) finishTask();
+}
+
+bool s21::ExportWorker::trySubmit(ExportTask& task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_++;
+  }
+  if (queue_.tryPush(task)) return true;
+  finishTask();
+  return false;
+}
+
+void s21::ExportWorker::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock, [this] { return pending_ == 0; });
+}
+
+std::size_t s21::ExportWorker::pending() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_;
+}
+
+void s21::ExportWorker::workerLoop() {
+  while (std::optional<ExportTask> task = queue_.pop()) {
+    bool ok = !task->run || task->run();
+    if (task->done) task->done(ok);
+    finishTask();
+  }
+}
+
+void s21::ExportWorker::finishTask() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (--pending_ == 0) idle_.notify_all();
+}
@@ -0,0 +1,96 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_EXPORT_WORKER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_EXPORT_WORKER_HPP_
+
+/************************************************************
+ * @file export_worker.hpp
+ * @brief Фоновое кодирование и запись снимков и анимаций
+ ************************************************************/
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "bounded_queue.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Задача экспорта
+ ************************************************************/
+struct ExportTask {
+  std::function<bool()> run;       // Кодирование и запись, true при успехе
+  std::function<void(bool)> done;  // Вызывается после run с его результатом
+};
+
+/************************************************************
+ * @brief Класс фонового потока экспорта
+ *
+ * Поток интерфейса передает готовый кадр в задаче, а кодирование, сжатие
+ *и запись файла выполняются в отдельном потоке. Задачи выполняются по
+ *одной в порядке постановки, поэтому кадры анимации попадают в файл по
+ *порядку. Очередь ограничена: submit ждет свободного места, а trySubmit
+ *сразу возвращает false, и кадр можно передать позже, поэтому кадры не
+ *теряются, а память не растет, если кодирование отстает.
+ *
+ * done вызывается в потоке экспорта; чтобы обновить интерфейс, его нужно
+ *переслать в поток интерфейса, например через QMetaObject::invokeMethod.
+ ************************************************************/
+class ExportWorker {
+ public:
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param capacity Наибольшее число задач в очереди
+   ************************************************************/
+  explicit ExportWorker(std::size_t capacity = 8);
+
+  ExportWorker(const ExportWorker& other) = delete;
+  ExportWorker& operator=(const ExportWorker& other) = delete;
+
+  /************************************************************
+   * @brief Деструктор
+   * @details Выполняет оставшиеся задачи и завершает поток
+   ************************************************************/
+  ~ExportWorker();
+
+  /************************************************************
+   * @brief Метод для постановки задачи с ожиданием места в очереди
+   * @return void
+   ************************************************************/
+  void submit(ExportTask task);
+
+  /************************************************************
+   * @brief Метод для постановки задачи без ожидания
+   * @details task перемещается в очередь только при успехе
+   * @return false, если очередь полна
+   ************************************************************/
+  bool trySubmit(ExportTask& task);
+
+  /************************************************************
+   * @brief Метод для ожидания выполнения всех поставленных задач
+   * @return void
+   ************************************************************/
+  void wait();
+
+  /************************************************************
+   * @brief Количество поставленных и еще не выполненных задач
+   ************************************************************/
+  std::size_t pending() const;
+
+  std::size_t capacity() const { return queue_.capacity(); }
+
+ private:
+  void workerLoop();
+  void finishTask();
+
+  BoundedQueue<ExportTask> queue_;
+  mutable std::mutex mutex_;
+  std::condition_variable idle_;
+  std::size_t pending_ = 0;
+  std::thread thread_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_EXPORT_WORKER_HPP_
@@ -0,0 +1,107 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+/************************************************************
+ * @file thread_pool.cpp
+ * @brief Пул потоков для параллельной обработки модели
+ ************************************************************/
+
+s21::ThreadPool::ThreadPool(std::size_t threads) {
+  if (threads == 0) {
+    threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(threads);
+  for (std::size_t i = 0; i < threads; i++) {
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+s21::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+s21::ThreadPool& s21::ThreadPool::shared() {
+  static ThreadPool pool;
+  return pool;
+}
+
+void s21::ThreadPool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void s21::ThreadPool::parallelFor(
+    std::size_t count, const std::function<void(std::size_t)>& body) {
+  if (count == 0) return;
+  if (count == 1) {
+    body(0);
+    return;
+  }
+
+  struct State {
+    std::atomic<std::size_t> next{0};
+    std::size_t done = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto state = std::make_shared<State>();
+  std::size_t total = count;
+  auto run = [state, total, &body] {
+    std::size_t completed = 0;
+    for (std::size_t i = state->next++; i < total; i = state->next++) {
+      try {
+        body(i);
+      } catch (...) {
+        // Невыданные итерации отменяются и засчитываются этому участнику,
+        // чтобы вызывающий поток дождался остальных и бросил исключение
+        std::size_t claimed = state->next.exchange(total);
+        if (claimed < total) completed += total - claimed;
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->error) state->error = std::current_exception();
+      }
+      completed++;
+    }
+    if (completed != 0) {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->done += completed;
+      if (state->done == total) state->finished.notify_all();
+    }
+  };
+
+  std::size_t helpers = std::min(size(), count - 1);
+  for (std::size_t i = 0; i < helpers; i++) submit(run);
+  run();
+
+  // body живет в стеке вызывающего, поэтому выход из метода, в том числе
+  // с исключением, возможен только после всех итераций
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->done == total; });
+  if (state->error) std::rethrow_exception(state->error);
+}
+
+void s21::ThreadPool::workerLoop() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (stop_ && tasks_.empty()) return;
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
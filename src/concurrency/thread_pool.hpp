@@ -0,0 +1,88 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_THREAD_POOL_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_THREAD_POOL_HPP_
+
+/************************************************************
+ * @file thread_pool.hpp
+ * @brief Пул потоков для параллельной обработки модели
+ ************************************************************/
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Пул потоков с общей очередью задач
+ *
+ * Потоки создаются один раз и живут до уничтожения пула, поэтому
+ *запуск параллельной операции не требует создания новых потоков.
+ ************************************************************/
+class ThreadPool {
+ public:
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param threads Количество потоков. 0 - по количеству ядер
+   ************************************************************/
+  explicit ThreadPool(std::size_t threads = 0);
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /************************************************************
+   * @brief Деструктор
+   * @details Дожидается выполнения поставленных задач и завершает потоки
+   ************************************************************/
+  ~ThreadPool();
+
+  /************************************************************
+   * @brief Общий пул потоков приложения
+   *
+   * Пул создается при первом обращении и содержит по одному потоку на ядро
+   ************************************************************/
+  static ThreadPool& shared();
+
+  /************************************************************
+   * @brief Количество потоков в пуле
+   ************************************************************/
+  std::size_t size() const { return workers_.size(); }
+
+  /************************************************************
+   * @brief Метод для постановки задачи в очередь
+   * @param task Задача
+   * @return void
+   ************************************************************/
+  void submit(std::function<void()> task);
+
+  /************************************************************
+   * @brief Метод для параллельного выполнения body(0) ... body(count - 1)
+   *
+   * Вызывающий поток тоже выполняет итерации, поэтому метод можно вызывать
+   *из задач самого пула. Возвращает управление после выполнения всех
+   *итераций. Если body бросает исключение, еще не начатые итерации
+   *отменяются, и после завершения начатых первое исключение бросается
+   *в вызывающем потоке.
+   * @param count Количество итераций
+   * @param body Тело итерации
+   * @return void
+   ************************************************************/
+  void parallelFor(std::size_t count,
+                   const std::function<void(std::size_t)>& body);
+
+ private:
+  void workerLoop();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_ = false;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_CONCURRENCY_THREAD_POOL_HPP_
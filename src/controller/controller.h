@@ -1,6 +1,10 @@
 #ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_CONTROLLER_HPP_
 #define CPP4_3DVIEWER_V2_0_1_SRC_3D_CONTROLLER_HPP_
+#include "../cache/model_cache.hpp"
+#include "../loader/async_loader.hpp"
 #include "../manipulation/manipulation.hpp"
+#include "../transformation/matrix.hpp"
+#include <cstdint>
 #include <vector>
 
 /************************************************************
@@ -10,6 +14,16 @@
 
 namespace s21{
 
+/**
+ * @brief Способ применения преобразований модели
+*/
+enum class TransformMode {
+    /** Каждое преобразование сразу переписывает все вершины */
+    kImmediate,
+    /** Преобразования накапливаются в матрице модели, вершины не меняются */
+    kDeferred
+};
+
 /**
  * @brief Реализация паттерна "Синглтон" в контроллере
 */
@@ -34,9 +48,141 @@ public:
     *
     * @param move Название преобразования
     * @param val Значение, указывающий или шаг, или угол, или коэффициент масштабирования
+    * В режиме TransformMode::kDeferred преобразование только домножает
+    * матрицу модели. Во время потоковой загрузки вершины не преобразуются:
+    * пачки, которые еще не пришли, остались бы непреобразованными, поэтому
+    * преобразование откладывается в pendingTransform и применяется после
+    * загрузки.
     ************************************************************/
     void TransformModel(Movement move, double val) {
+        if (transform_mode == TransformMode::kDeferred) {
+            matrix = Matrix4::fromMovement(move, val) * matrix;
+            materialized = false;
+            return;
+        }
+        if (streaming) {
+            pending = Matrix4::fromMovement(move, val) * pending;
+            return;
+        }
         model.TransformModel(object.vertexes, move, val);
+        markModified();
+    }
+
+    /************************************************************
+    * @brief Метод для пакетного преобразования модели
+    *
+    * @param operations Преобразования в порядке применения
+    * Преобразования сворачиваются в одну матрицу: в TransformMode::kDeferred
+    * она домножает матрицу модели, иначе применяется к вершинам за один
+    * проход вместо отдельного прохода на каждое преобразование. Во время
+    * потоковой загрузки откладывается, как и TransformModel.
+    ************************************************************/
+    void TransformBatch(const std::vector<TransformOperation>& operations) {
+        if (operations.empty()) return;
+        if (transform_mode == TransformMode::kDeferred) {
+            matrix = Matrix4::fromOperations(operations) * matrix;
+            materialized = false;
+            return;
+        }
+        if (streaming) {
+            pending = Matrix4::fromOperations(operations) * pending;
+            return;
+        }
+        model.TransformBatch(object.vertexes, operations);
+        markModified();
+    }
+
+    /************************************************************
+    * @brief Метод для откладывания преобразования до следующего кадра
+    *
+    * Отложенные преобразования применяются одним TransformBatch в
+    * applyQueuedTransforms. Новая загрузка модели их сбрасывает, чтобы
+    * они не попали на другую модель.
+    * @param move Название преобразования
+    * @param val Значение преобразования
+    ************************************************************/
+    void queueTransform(Movement move, double val) {
+        queued.push_back(TransformOperation{move, val});
+    }
+
+    /**
+     * @brief Метод, применяющий отложенные преобразования одним пакетом
+    */
+    void applyQueuedTransforms() {
+        if (queued.empty()) return;
+        TransformBatch(queued);
+        queued.clear();
+    }
+
+    /**
+     * @brief Метод, сбрасывающий отложенные преобразования
+    */
+    void discardQueuedTransforms() {
+        queued.clear();
+    }
+
+    /************************************************************
+    * @brief Метод для выбора способа применения преобразований
+    *
+    * При переходе в TransformMode::kImmediate накопленная матрица
+    * применяется к вершинам.
+    * @param mode Способ применения преобразований
+    ************************************************************/
+    void setTransformMode(TransformMode mode) {
+        if (mode == transform_mode) return;
+        if (mode == TransformMode::kImmediate && streaming) {
+            pending = matrix * pending;
+        } else if (mode == TransformMode::kImmediate && !matrix.isIdentity()) {
+            matrix.apply(object.vertexes, object.vertexes);
+            markModified();
+        }
+        transform_mode = mode;
+        resetTransform();
+    }
+
+    /**
+     * @brief Текущий способ применения преобразований
+    */
+    TransformMode transformMode() const {
+        return transform_mode;
+    }
+
+    /**
+     * @brief Матрица модели
+     *
+     * В режиме TransformMode::kImmediate всегда единичная. Вершины в
+     * getObject остаются такими, какими были загружены, а отрисовка
+     * домножает их на эту матрицу.
+    */
+    const Matrix4& modelMatrix() const {
+        return matrix;
+    }
+
+    /**
+     * @brief Преобразования вершин, отложенные до конца потоковой загрузки
+     *
+     * Применяются к вершинам после нормализации, поэтому при показе модели
+     * во время загрузки стоят между матрицей модели и предварительной
+     * нормализацией. Вне потоковой загрузки - единичная матрица.
+    */
+    const Matrix4& pendingTransform() const {
+        return pending;
+    }
+
+    /**
+     * @brief Вершины модели с примененной матрицей модели
+     *
+     * Вычисляются одним проходом при первом обращении после изменения
+     * матрицы, для экспорта, выбора точек и статистики.
+     * @return Преобразованные вершины
+    */
+    const VertexArray& transformedVertexes() {
+        if (matrix.isIdentity()) return object.vertexes;
+        if (!materialized) {
+            matrix.apply(object.vertexes, transformed);
+            materialized = true;
+        }
+        return transformed;
     }
 
     /************************************************************
@@ -44,6 +190,7 @@ public:
     ************************************************************/
     void Normalization() {
         model.Normalization(object.vertexes);
+        markModified();
     }
 
     /**
@@ -54,6 +201,40 @@ public:
         return object;
     }
 
+    /**
+     * @brief Номер изменения модели
+     *
+     * Увеличивается при каждом изменении вершин, полигонов или ребер через
+     * контроллер, поэтому отрисовка загружает модель в видеопамять только
+     * после ее изменения. Преобразования в TransformMode::kDeferred меняют
+     * только матрицу модели и номер не увеличивают.
+    */
+    std::uint64_t revision() const {
+        return revision_;
+    }
+
+    /**
+     * @brief Метод, сообщающий об изменении модели в обход контроллера
+     *
+     * Нужен после правки модели через getObject. Преобразованные вершины
+     * transformedVertexes после этого вычисляются заново.
+    */
+    void markModified() {
+        markAppended();
+        ++rewrite_revision_;
+    }
+
+    /**
+     * @brief Номер последнего изменения, переписавшего модель
+     *
+     * В отличие от revision не увеличивается, когда потоковая загрузка
+     * только дописывает в модель вершины и полигоны. Пока он прежний,
+     * отрисовка может догружать в видеопамять лишь новые данные.
+    */
+    std::uint64_t rewriteRevision() const {
+        return rewrite_revision_;
+    }
+
     /**
      * @brief Метод для очистки векторов вершин и полигонов (фасетов) 
      * @return void
@@ -61,23 +242,220 @@ public:
     void clearObject() {
         object.vertexes.clear();
         object.lines.clear();
+        object.edges.clear();
+        resetTransform();
+        pending = Matrix4();
+        markModified();
     }
 
     /**
      * @brief Метод для считывания информации о 3д моделе из файла
      * @param filename путь до файла 
+     * @param mode способ чтения файла
      * @return void
     */
-    void parseFile(std::string filename) {
-        model.parseFile(object, filename);
+    void parseFile(std::string filename, ParseMode mode = ParseMode::kMapped) {
+        resetTransform();
+        model.parseFile(object, filename, mode);
+        object.edges.build(object.lines, object.vertexes.size());
+        markModified();
+    }
+
+    /**
+     * @brief Метод для загрузки 3д модели с использованием бинарного кэша
+     *
+     * Если в каталоге кэша есть действительный снимок файла, модель
+     * загружается из него без разбора текста. Иначе файл разбирается, и
+     * после успешного разбора снимок записывается в кэш.
+     * @param filename путь до файла
+     * @param cache_dir каталог кэша
+     * @return true, если модель загружена из кэша
+    */
+    bool parseFileCached(std::string filename, const std::string& cache_dir) {
+        ModelCache cache(cache_dir);
+        clearObject();
+        bool cached = cache.load(filename, object);
+        if (!cached) {
+            model.parseFile(object, filename);
+            if (!object.vertexes.empty()) cache.store(filename, object);
+        }
+        object.edges.build(object.lines, object.vertexes.size());
+        markModified();
+        return cached;
+    }
+
+    /**
+     * @brief Метод для запуска загрузки 3д модели в фоновом потоке
+     *
+     * Разбор и нормализация выполняются в отдельном потоке, текущая модель
+     * не меняется до вызова commitLoadedModel. Незавершенная предыдущая
+     * загрузка отменяется.
+     * @param filename путь до файла
+     * @param cache_dir каталог бинарного кэша, пустая строка - без кэша
+     * @return void
+    */
+    void parseFileAsync(std::string filename, std::string cache_dir = {}) {
+        if (streaming) finishStreaming();
+        loader.start(std::move(filename), std::move(cache_dir));
+    }
+
+    /**
+     * @brief Метод для запуска потоковой загрузки 3д модели
+     *
+     * Текущая модель сразу очищается, а разобранные вершины и полигоны
+     * дописываются в нее при каждом вызове commitLoadedModel, так что
+     * модель можно показывать, пока файл еще читается. До окончания
+     * загрузки вершины не нормализуются: для отображения используется
+     * предварительный параллелепипед streamingBounds, который уточняется
+     * с каждой пачкой.
+     * @param filename путь до файла
+     * @param cache_dir каталог бинарного кэша, пустая строка - без кэша
+     * @return void
+    */
+    void parseFileStreaming(std::string filename, std::string cache_dir = {}) {
+        loader.cancel();
+        clearObject();
+        discardQueuedTransforms();
+        bounds.reset();
+        streaming = true;
+        loader.start(std::move(filename), std::move(cache_dir), true);
+    }
+
+    /**
+     * @brief Идет ли потоковая загрузка
+    */
+    bool isStreaming() const {
+        return streaming;
+    }
+
+    /**
+     * @brief Предварительный параллелепипед модели при потоковой загрузке
+    */
+    const Bounds& streamingBounds() const {
+        return bounds;
+    }
+
+    /**
+     * @brief Метод для отмены фоновой загрузки
+     * @return void
+    */
+    void cancelLoading() {
+        loader.cancel();
+        if (streaming) finishStreaming();
+    }
+
+    /**
+     * @brief Состояние фоновой загрузки
+    */
+    LoadState loadingState() const {
+        return loader.state();
+    }
+
+    /**
+     * @brief Прогресс фоновой загрузки: обработанные байты и записи
+    */
+    const ParseProgress& loadingProgress() const {
+        return loader.progress();
+    }
+
+    /**
+     * @brief Отчет о последней фоновой загрузке: количества и времена этапов
+    */
+    const LoadReport& loadReport() const {
+        return loader.report();
+    }
+
+    /**
+     * @brief Метод для замены текущей модели загруженной в фоне
+     *
+     * Вызывается из того же потока, что и отрисовка, поэтому отрисовка
+     * видит либо прежнюю модель, либо новую целиком. При потоковой
+     * загрузке дописывает в модель пришедшие пачки, а по окончании
+     * загрузки нормализует ее.
+     * @return true, если загруженная модель была готова и подменила текущую
+    */
+    bool commitLoadedModel() {
+        if (!streaming) {
+            if (!loader.takeResult(object)) return false;
+            resetTransform();
+            discardQueuedTransforms();
+            markModified();
+            return true;
+        }
+        std::size_t first = object.vertexes.size();
+        std::size_t first_face = object.lines.size();
+        bool done = loader.takeResult(object);
+        LoadState state = loader.state();
+        if (!done) loader.takeBatches(object);
+        bounds.extend(object.vertexes, first);
+        if (object.vertexes.size() != first ||
+            object.lines.size() != first_face) {
+            markAppended();
+        }
+        if (done || state == LoadState::kCancelled ||
+            state == LoadState::kFailed) {
+            finishStreaming(done);
+        }
+        return done;
     }
 
 private:
     Controller() = default;
+
+    /**
+     * @brief Метод для завершения потоковой загрузки
+     * @details Проверяет индексы полигонов, строит таблицу ребер,
+     * нормализует то, что успело загрузиться, по уже посчитанному
+     * параллелепипеду bounds, и применяет отложенные преобразования
+     * @param completed Загружен ли файл целиком. Тогда модель, как и в
+     * LoadPipeline, до нормализации сохраняется в кэш в фоновом потоке
+    */
+    void finishStreaming(bool completed = false) {
+        streaming = false;
+        object.lines.validate(object.vertexes.size());
+        if (completed) loader.storeCache(object);
+        object.edges.build(object.lines, object.vertexes.size());
+        if (!object.vertexes.empty()) model.Normalization(object.vertexes, bounds);
+        bounds.reset();
+        if (!pending.isIdentity()) {
+            pending.apply(object.vertexes, object.vertexes);
+            pending = Matrix4();
+        }
+        markModified();
+    }
+
+    /**
+     * @brief Метод, сообщающий о дописанных в конец модели данных
+    */
+    void markAppended() {
+        ++revision_;
+        materialized = false;
+    }
+
+    /**
+     * @brief Метод для сброса матрицы модели
+    */
+    void resetTransform() {
+        matrix = Matrix4();
+        materialized = false;
+        transformed.clear();
+    }
+
     ~Controller() = default;
     
     Object object;
     ManipulationFacade model;
+    AsyncLoader loader;
+    bool streaming = false;
+    Bounds bounds;
+    TransformMode transform_mode = TransformMode::kImmediate;
+    Matrix4 matrix;
+    Matrix4 pending;
+    std::vector<TransformOperation> queued;
+    VertexArray transformed;
+    bool materialized = false;
+    std::uint64_t revision_ = 0;
+    std::uint64_t rewrite_revision_ = 0;
 };
 }
 
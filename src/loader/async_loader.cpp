@@ -0,0 +1,141 @@
+#include "async_loader.hpp"
+
+#include <filesystem>
+#include <type_traits>
+#include <utility>
+
+#include "../cache/model_cache.hpp"
+
+/************************************************************
+ * @file async_loader.cpp
+ * @brief Загрузка 3д модели в фоновом потоке
+ ************************************************************/
+
+s21::AsyncLoader::~AsyncLoader() { cancel(); }
+
+void s21::AsyncLoader::start(std::string filename, std::string cache_dir,
+                             bool streaming) {
+  cancel();
+  progress_.reset();
+  result_ = Object{};
+  report_ = LoadReport{};
+  streaming_ = streaming;
+  from_cache_ = false;
+  filename_ = filename;
+  cache_dir_ = cache_dir;
+  state_ = LoadState::kRunning;
+  worker_ = std::thread(&AsyncLoader::run, this, std::move(filename),
+                        std::move(cache_dir));
+}
+
+void s21::AsyncLoader::cancel() {
+  if (worker_.joinable()) {
+    progress_.cancelled = true;
+    worker_.join();
+  }
+  if (state_ == LoadState::kRunning || state_ == LoadState::kFinished) {
+    state_ = LoadState::kCancelled;
+  }
+  result_ = Object{};
+  std::lock_guard<std::mutex> lock(batches_mutex_);
+  batches_.clear();
+}
+
+void s21::AsyncLoader::wait() {
+  if (worker_.joinable()) worker_.join();
+}
+
+bool s21::AsyncLoader::takeResult(Object& object) {
+  if (state_ != LoadState::kFinished) return false;
+  wait();
+  if (streaming_) {
+    takeBatches(object);
+  } else {
+    object = std::move(result_);
+  }
+  state_ = LoadState::kIdle;
+  return true;
+}
+
+bool s21::AsyncLoader::takeBatches(Object& object) {
+  std::vector<Object> batches;
+  {
+    std::lock_guard<std::mutex> lock(batches_mutex_);
+    batches.swap(batches_);
+  }
+  for (Object& batch : batches) {
+    object.vertexes.append(batch.vertexes);
+    object.lines.append(batch.lines);
+  }
+  return !batches.empty();
+}
+
+void s21::AsyncLoader::storeCache(const Object& object) {
+  if (!streaming_ || from_cache_ || cache_dir_.empty() ||
+      object.vertexes.empty()) {
+    return;
+  }
+  wait();
+  Object snapshot;
+  snapshot.vertexes = object.vertexes;
+  snapshot.lines = object.lines;
+  worker_ = std::thread([this, snapshot = std::move(snapshot)] {
+    ModelCache(cache_dir_).store(filename_, snapshot, &progress_.cancelled);
+  });
+}
+
+// Пачки и снимок для кэша передаются перемещением: если Object потеряет
+// операции перемещения, std::move молча станет копированием массивов
+static_assert(std::is_nothrow_move_constructible_v<s21::Object> &&
+                  std::is_nothrow_move_assignable_v<s21::Object>,
+              "Object must move without copying its arrays");
+
+void s21::AsyncLoader::publish(Object& batch) {
+  std::lock_guard<std::mutex> lock(batches_mutex_);
+  batches_.push_back(std::move(batch));
+}
+
+void s21::AsyncLoader::run(std::string filename, std::string cache_dir) {
+  if (!streaming_) {
+    LoadPipeline pipeline(&progress_);
+    bool loaded = pipeline.load(filename, result_, cache_dir);
+    report_ = pipeline.report();
+    if (progress_.cancelled) {
+      state_ = LoadState::kCancelled;
+    } else {
+      state_ = loaded ? LoadState::kFinished : LoadState::kFailed;
+    }
+    return;
+  }
+
+  bool cached = false;
+  if (!cache_dir.empty()) {
+    // Разбор сам задает размер файла, а при чтении кэша его нужно знать
+    // заранее, чтобы прогресс не стоял на нуле
+    std::error_code error;
+    std::uintmax_t size = std::filesystem::file_size(filename, error);
+    progress_.total_bytes = error ? 0 : static_cast<std::size_t>(size);
+    cached = ModelCache(cache_dir).load(filename, result_);
+  }
+  std::size_t vertexes = 0;
+  from_cache_ = cached;
+  if (cached) {
+    progress_.bytes = progress_.total_bytes.load();
+    progress_.records = result_.vertexes.size() + result_.lines.size();
+    vertexes = result_.vertexes.size();
+    publish(result_);
+  } else {
+    ObjectParser parser;
+    parser.setProgress(&progress_);
+    parser.setBatchHandler([this, &vertexes](Object& batch) {
+      vertexes += batch.vertexes.size();
+      publish(batch);
+    });
+    parser.parseFile(result_, filename, ParseMode::kMapped);
+  }
+  if (progress_.cancelled) {
+    state_ = LoadState::kCancelled;
+    return;
+  }
+  state_ = vertexes == 0 ? LoadState::kFailed : LoadState::kFinished;
+}
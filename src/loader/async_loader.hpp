@@ -0,0 +1,155 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_LOADER_ASYNC_LOADER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_LOADER_ASYNC_LOADER_HPP_
+
+/************************************************************
+ * @file async_loader.hpp
+ * @brief Загрузка 3д модели в фоновом потоке
+ ************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_pipeline.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Состояние фоновой загрузки
+ ************************************************************/
+enum class LoadState { kIdle, kRunning, kFinished, kCancelled, kFailed };
+
+/************************************************************
+ * @brief Класс для загрузки модели в фоновом потоке
+ *
+ * Разбор файла и нормализация выполняются в отдельном потоке в собственный
+ *Object конвейером LoadPipeline. Пока загрузка идет, прежняя модель
+ *остается нетронутой; готовая модель подменяет ее перемещением в
+ *takeResult, без копирования массивов.
+ *
+ * В потоковом режиме модель не собирается в потоке целиком: разобранные
+ *вершины и полигоны публикуются пачками, и вызывающий поток дописывает их
+ *в свой объект через takeBatches, пока загрузка еще идет. Нормализация в
+ *этом режиме остается вызывающему.
+ *
+ * Снимок из кэша отображается в память, но в Object его массивы
+ *копируются: VertexArray и FaceArray владеют своими векторами, и модель
+ *должна пережить файл кэша. Копирование идет в фоновом потоке одним
+ *проходом memcpy, без разбора текста.
+ ************************************************************/
+class AsyncLoader {
+ public:
+  /************************************************************
+   * @brief Конструктор по умолчанию
+   ************************************************************/
+  AsyncLoader() = default;
+
+  AsyncLoader(const AsyncLoader& other) = delete;
+  AsyncLoader& operator=(const AsyncLoader& other) = delete;
+
+  /************************************************************
+   * @brief Деструктор
+   * @details Отменяет незавершенную загрузку и дожидается потока
+   ************************************************************/
+  ~AsyncLoader();
+
+  /************************************************************
+   * @brief Метод для запуска загрузки
+   *
+   * Незавершенная предыдущая загрузка отменяется.
+   * @param filename Путь до obj файла
+   * @param cache_dir Каталог бинарного кэша. Пустая строка - без кэша
+   * @param streaming Публиковать ли модель пачками по мере разбора
+   * @return void
+   ************************************************************/
+  void start(std::string filename, std::string cache_dir = {},
+             bool streaming = false);
+
+  /************************************************************
+   * @brief Метод для отмены загрузки
+   * @details Дожидается остановки потока, результат отбрасывается. Поток
+   *проверяет отмену при разборе, хэшировании и записи кэша и между этапами
+   *обработки, поэтому ожидание короткое
+   * @return void
+   ************************************************************/
+  void cancel();
+
+  /************************************************************
+   * @brief Метод для ожидания окончания загрузки
+   * @return void
+   ************************************************************/
+  void wait();
+
+  /************************************************************
+   * @brief Текущее состояние загрузки
+   ************************************************************/
+  LoadState state() const { return state_.load(); }
+
+  /************************************************************
+   * @brief Прогресс загрузки: байты и записи
+   ************************************************************/
+  const ParseProgress& progress() const { return progress_; }
+
+  /************************************************************
+   * @brief Отчет о последней загрузке с временами этапов
+   * @details Заполняется к моменту kFinished, кроме потокового режима
+   ************************************************************/
+  const LoadReport& report() const { return report_; }
+
+  /************************************************************
+   * @brief Метод для получения загруженной модели
+   *
+   * Если загрузка завершена, загруженная модель перемещается в object, и
+   *состояние становится kIdle. В потоковом режиме в object
+   *дописываются оставшиеся пачки.
+   * @param object Объект, в который помещается модель
+   * @return true, если модель была готова
+   ************************************************************/
+  bool takeResult(Object& object);
+
+  /************************************************************
+   * @brief Метод для получения опубликованных пачек
+   *
+   * Дописывает в конец object вершины и полигоны, разобранные с прошлого
+   *вызова. Имеет смысл только в потоковом режиме.
+   * @param object Объект, в который дописываются пачки
+   * @return true, если что-то было дописано
+   ************************************************************/
+  bool takeBatches(Object& object);
+
+  /************************************************************
+   * @brief Метод для записи в кэш модели, собранной потоковой загрузкой
+   *
+   * В потоковом режиме модель собирается из пачек в вызывающем потоке,
+   *поэтому снимок для кэша записывает он, когда модель собрана и индексы
+   *проверены, но еще не нормализована. Массивы копируются, а хэширование и
+   *запись идут в фоновом потоке; следующий start или cancel прерывает
+   *запись. Ничего не делает, если кэш не задан или модель загружена из
+   *него.
+   * @param object Собранная модель
+   * @return void
+   ************************************************************/
+  void storeCache(const Object& object);
+
+ private:
+  void run(std::string filename, std::string cache_dir);
+  void publish(Object& batch);
+
+  std::thread worker_;
+  std::atomic<LoadState> state_{LoadState::kIdle};
+  ParseProgress progress_;
+  Object result_;
+  LoadReport report_;
+  bool streaming_ = false;
+  bool from_cache_ = false;
+  std::string filename_;
+  std::string cache_dir_;
+  std::mutex batches_mutex_;
+  std::vector<Object> batches_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_LOADER_ASYNC_LOADER_HPP_
@@ -0,0 +1,113 @@
+#include "load_pipeline.hpp"
+
+#include <chrono>
+#include <filesystem>
+
+#include "../cache/model_cache.hpp"
+
+/************************************************************
+ * @file load_pipeline.cpp
+ * @brief Конвейер загрузки 3д модели с замером этапов
+ ************************************************************/
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double millisecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+s21::LoadPipeline::LoadPipeline(ParseProgress* progress)
+    : progress_{progress} {}
+
+bool s21::LoadPipeline::load(const std::string& filename, Object& object,
+                             const std::string& cache_dir) {
+  Clock::time_point begin = Clock::now();
+  report_ = LoadReport{};
+  object = Object{};
+
+  // Отмена проверяется и между этапами после разбора: запись кэша и
+  // построение ребер большой модели занимают заметное время
+  auto cancelled = [this] {
+    return progress_ != nullptr && progress_->cancelled;
+  };
+  Bounds bounds;
+  EdgeBuilder edges;
+  Clock::time_point stage = Clock::now();
+  if (!cache_dir.empty()) {
+    // При попадании в кэш парсер не запускается и размер не задает
+    if (progress_ != nullptr) {
+      std::error_code error;
+      std::uintmax_t size = std::filesystem::file_size(filename, error);
+      progress_->total_bytes = error ? 0 : static_cast<std::size_t>(size);
+    }
+    report_.cached = ModelCache(cache_dir).load(filename, object);
+  }
+  if (report_.cached) {
+    if (progress_ != nullptr) {
+      progress_->bytes = progress_->total_bytes.load();
+      progress_->records = object.vertexes.size() + object.lines.size();
+    }
+  } else {
+    ObjectParser parser;
+    parser.setProgress(progress_);
+    parser.setBounds(&bounds);
+    parser.setBatchHandler([&](Object& batch) {
+      Clock::time_point start = Clock::now();
+      edges.addFaces(batch.lines);
+      report_.edges_ms += millisecondsSince(start);
+      object.vertexes.append(batch.vertexes);
+      object.lines.append(batch.lines);
+    });
+    Object batch;
+    parser.parseFile(batch, filename, ParseMode::kMapped);
+  }
+  report_.parse_ms = millisecondsSince(stage) - report_.edges_ms;
+  if (cancelled()) return false;
+  if (object.vertexes.empty()) return false;
+
+  stage = Clock::now();
+  if (!report_.cached) {
+    report_.validation = object.lines.validate(object.vertexes.size());
+  }
+  report_.validate_ms = millisecondsSince(stage);
+
+  if (!report_.cached && !cache_dir.empty() && !cancelled()) {
+    stage = Clock::now();
+    ModelCache(cache_dir).store(filename, object,
+                                progress_ != nullptr ? &progress_->cancelled
+                                                     : nullptr);
+    report_.cache_ms = millisecondsSince(stage);
+  }
+  if (cancelled()) return false;
+
+  // Исправленные полигоны дают другие ребра, чем собрал builder, поэтому
+  // в этом редком случае таблица строится заново по полигонам
+  stage = Clock::now();
+  if (report_.cached || !report_.validation.clean()) {
+    object.edges.build(object.lines, object.vertexes.size());
+  } else {
+    object.edges.build(edges, object.vertexes.size());
+  }
+  report_.edges_ms += millisecondsSince(stage);
+  if (cancelled()) return false;
+
+  stage = Clock::now();
+  if (bounds.empty()) {
+    model_.Normalization(object.vertexes);
+  } else {
+    model_.Normalization(object.vertexes, bounds);
+  }
+  report_.normalize_ms = millisecondsSince(stage);
+
+  report_.vertexes = object.vertexes.size();
+  report_.faces = object.lines.size();
+  report_.indexes = object.lines.indexCount();
+  report_.edges = object.edges.size();
+  report_.total_ms = millisecondsSince(begin);
+  return true;
+}
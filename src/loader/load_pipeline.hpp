@@ -0,0 +1,117 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_LOADER_LOAD_PIPELINE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_LOADER_LOAD_PIPELINE_HPP_
+
+/************************************************************
+ * @file load_pipeline.hpp
+ * @brief Конвейер загрузки 3д модели с замером этапов
+ ************************************************************/
+
+#include <cstddef>
+#include <string>
+
+#include "../manipulation/manipulation.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Отчет о загрузке модели
+ *
+ * Времена этапов в миллисекундах. Параллелепипед считается внутри разбора,
+ *поэтому отдельного времени у него нет.
+ ************************************************************/
+struct LoadReport {
+  /************************************************************
+   * @brief Чтение кэша или разбор файла вместе с параллелепипедом
+   ************************************************************/
+  double parse_ms = 0;
+
+  /************************************************************
+   * @brief Проверка индексов полигонов
+   ************************************************************/
+  double validate_ms = 0;
+
+  /************************************************************
+   * @brief Сбор ребер из пачек и построение таблицы ребер
+   ************************************************************/
+  double edges_ms = 0;
+
+  /************************************************************
+   * @brief Запись снимка в кэш
+   ************************************************************/
+  double cache_ms = 0;
+
+  /************************************************************
+   * @brief Нормализация вершин
+   ************************************************************/
+  double normalize_ms = 0;
+
+  /************************************************************
+   * @brief Вся загрузка
+   ************************************************************/
+  double total_ms = 0;
+
+  /************************************************************
+   * @brief Количество вершин, полигонов, индексов и уникальных ребер
+   ************************************************************/
+  std::size_t vertexes = 0;
+  std::size_t faces = 0;
+  std::size_t indexes = 0;
+  std::size_t edges = 0;
+
+  /************************************************************
+   * @brief Недопустимые индексы, исправленные и удаленные полигоны
+   ************************************************************/
+  FaceValidation validation;
+
+  /************************************************************
+   * @brief Загружена ли модель из кэша
+   ************************************************************/
+  bool cached = false;
+};
+
+/************************************************************
+ * @brief Класс конвейера загрузки модели
+ *
+ * Файл разбирается пачками. Каждая пачка, пока она в кэше процессора,
+ *расширяет параллелепипед, отдает свои ребра в EdgeBuilder и дописывается
+ *в модель, поэтому после разбора не нужны отдельные проходы по вершинам
+ *для поиска min/max и по полигонам для ребер. Остаются проверка индексов,
+ *сортировка корзин ребер и один проход нормализации.
+ ************************************************************/
+class LoadPipeline {
+ public:
+  /************************************************************
+   * @brief Конструктор
+   * @param progress Куда сообщать прогресс и откуда брать отмену, может
+   *быть nullptr
+   ************************************************************/
+  explicit LoadPipeline(ParseProgress* progress = nullptr);
+
+  /************************************************************
+   * @brief Метод для загрузки модели
+   *
+   * Модель загружается из кэша cache_dir, если там есть действительный
+   *снимок, иначе разбирается и сохраняется в кэш. Результат нормализован,
+   *индексы полигонов проверены, и таблица ребер построена.
+   * @param filename Путь до obj файла
+   * @param object Куда поместить модель, прежнее содержимое заменяется
+   * @param cache_dir Каталог бинарного кэша, пустая строка - без кэша
+   * @return true, если модель загружена и в ней есть вершины
+   ************************************************************/
+  bool load(const std::string& filename, Object& object,
+            const std::string& cache_dir = {});
+
+  /************************************************************
+   * @brief Отчет о последней загрузке
+   ************************************************************/
+  const LoadReport& report() const { return report_; }
+
+ private:
+  ParseProgress* progress_;
+  ManipulationFacade model_;
+  LoadReport report_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_LOADER_LOAD_PIPELINE_HPP_
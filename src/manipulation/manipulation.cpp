@@ -1,54 +1,112 @@
 #include "manipulation.hpp"
 
+#include "../transformation/axis_transform.hpp"
+#include "../transformation/kernels.hpp"
+#include "../transformation/matrix.hpp"
+
 /************************************************************
  * @file manipulation.cpp
  * @brief Логика модели
  ************************************************************/
 
-s21::ManipulationFacade::ManipulationFacade() : parser{}, transformer{} {}
+namespace {
+
+s21::Bounds rangeBounds(const s21::TransformKernels& kernels,
+                        s21::VertexRange range) {
+  s21::Bounds bounds;
+  if (range.size == 0) return bounds;
+  const s21::Scalar* axes[] = {range.x, range.y, range.z};
+  double* lows[] = {&bounds.min.x, &bounds.min.y, &bounds.min.z};
+  double* highs[] = {&bounds.max.x, &bounds.max.y, &bounds.max.z};
+  for (int axis = 0; axis < 3; axis++) {
+    s21::Scalar lo = axes[axis][0], hi = axes[axis][0];
+    kernels.bounds(axes[axis], range.size, &lo, &hi);
+    *lows[axis] = lo;
+    *highs[axis] = hi;
+  }
+  return bounds;
+}
+
+void normalizeRange(const s21::TransformKernels& kernels,
+                    s21::VertexRange range, const s21::Point& center,
+                    double scal) {
+  s21::Scalar* axes[] = {range.x, range.y, range.z};
+  double centers[] = {center.x, center.y, center.z};
+  for (int axis = 0; axis < 3; axis++) {
+    kernels.affine(axes[axis], range.size, static_cast<s21::Scalar>(scal),
+                   static_cast<s21::Scalar>(-centers[axis] * scal));
+  }
+}
+
+}  // namespace
+
+s21::ManipulationFacade::ManipulationFacade()
+    : parser{}, policy{} {}
+
+void s21::ManipulationFacade::setExecutionPolicy(
+    const ExecutionPolicy& policy) {
+  this->policy = policy;
+}
+
+void s21::ManipulationFacade::parseFile(Object& object, std::string filename,
+                                        ParseMode mode,
+                                        ParseProgress* progress,
+                                        Bounds* bounds) {
+  parser.setProgress(progress);
+  parser.setBounds(bounds);
+  parser.parseFile(object, filename, mode);
+  parser.setProgress(nullptr);
+  parser.setBounds(nullptr);
+}
 
-void s21::ManipulationFacade::parseFile(Object& object, std::string filename) {
-  parser.parseFile(object, filename);
+void s21::ManipulationFacade::TransformModel(VertexArray& vertexes,
+                                             Movement move, double val) {
+  TransformVertexes(vertexes, move, val, policy);
 }
 
 void s21::ManipulationFacade::TransformModel(std::vector<Point>& vertexes,
                                              Movement move, double val) {
-  if (move == MoveX || move == MoveY || move == MoveZ) {
-    Move strategy;
-    transformer.set_strategy(&strategy);
-  } else if (move == RotateX || move == RotateY || move == RotateZ) {
-    Rotate strategy;
-    transformer.set_strategy(&strategy);
-  } else {
-    Scale strategy;
-    transformer.set_strategy(&strategy);
-  }
-  transformer.TransformModel(vertexes, move, val);
-}
-
-void s21::ManipulationFacade::Normalization(std::vector<Point>& vertexes) {
-  double maxX = -100000000, maxY = -100000000, maxZ = -100000000;
-  double minX = 100000000, minY = 100000000, minZ = 100000000;
-  for (const Point& p : vertexes) {
-    maxX = maxX < p.x ? p.x : maxX;
-    maxY = maxY < p.y ? p.y : maxY;
-    maxZ = maxZ < p.z ? p.z : maxZ;
-    minX = minX > p.x ? p.x : minX;
-    minY = minY > p.y ? p.y : minY;
-    minZ = minZ > p.z ? p.z : minZ;
-  }
-  double centerX = minX + (maxX - minX) / 2;
-  double centerY = minY + (maxY - minY) / 2;
-  double centerZ = minZ + (maxZ - minZ) / 2;
-  double dmax = std::max(maxX - minX, maxY - minY);
-  dmax = std::max(dmax, maxZ - minZ);
-  double scal = (0.5 - (0.5 * (-1))) / dmax;
-  for (Point& p : vertexes) {
-    p.x -= centerX;
-    p.x *= scal;
-    p.y -= centerY;
-    p.y *= scal;
-    p.z -= centerZ;
-    p.z *= scal;
+  VertexArray array(vertexes);
+  TransformModel(array, move, val);
+  vertexes = array.toPoints();
+}
+
+void s21::ManipulationFacade::TransformBatch(
+    VertexArray& vertexes, const std::vector<TransformOperation>& operations) {
+  if (operations.empty()) return;
+  if (operations.size() == 1) {
+    TransformModel(vertexes, operations[0].move, operations[0].value);
+    return;
   }
+  Matrix4 matrix = Matrix4::fromOperations(operations);
+  forEachRange(policy, vertexes.size(),
+               [&](std::size_t, std::size_t first, std::size_t last) {
+                 matrix.apply(vertexes.range(first, last));
+               });
+}
+
+void s21::ManipulationFacade::Normalization(VertexArray& vertexes) {
+  const TransformKernels& kernels = transformKernels();
+  std::vector<Bounds> parts(rangeCount(policy, vertexes.size()));
+  forEachRange(policy, vertexes.size(),
+               [&](std::size_t index, std::size_t first, std::size_t last) {
+                 parts[index] =
+                     rangeBounds(kernels, vertexes.range(first, last));
+               });
+  Bounds bounds;
+  for (const Bounds& part : parts) bounds.extend(part);
+  Normalization(vertexes, bounds);
+}
+
+void s21::ManipulationFacade::Normalization(VertexArray& vertexes,
+                                            const Bounds& bounds) {
+  if (bounds.empty()) return;
+  const TransformKernels& kernels = transformKernels();
+  Point center = bounds.center();
+  double scal = (0.5 - (0.5 * (-1))) / bounds.extent();
+  forEachRange(policy, vertexes.size(),
+               [&](std::size_t, std::size_t first, std::size_t last) {
+                 normalizeRange(kernels, vertexes.range(first, last), center,
+                                scal);
+               });
 }
@@ -23,9 +23,9 @@ class ManipulationFacade {
   ObjectParser parser;
 
   /************************************************************
-   * @brief Объект осуществляющий преобразования модели
+   * @brief Политика выполнения преобразований и нормализации
    ************************************************************/
-  ObjectTransformer transformer;
+  ExecutionPolicy policy;
 
  public:
   /************************************************************
@@ -38,14 +38,31 @@ class ManipulationFacade {
    * @brief Метод для парсинга файла
    * @param object Ссылка на объект, в котором будет сохраняться информация
    * @param filename Путь до файла
+   * @param mode Способ чтения файла
+   * @param progress Куда сообщать прогресс разбора, может быть nullptr
+   * @param bounds Куда добавлять прочитанные вершины, может быть nullptr.
+   *Такой параллелепипед можно сразу передать в Normalization
    ************************************************************/
-  void parseFile(Object& object, std::string filename);
+  void parseFile(Object& object, std::string filename,
+                 ParseMode mode = ParseMode::kMapped,
+                 ParseProgress* progress = nullptr, Bounds* bounds = nullptr);
 
   /************************************************************
    * @brief Метод преобразования модели
    *
-   * В методе устанавливается стратегия, которая нам нужна, и вызывается метод
-   *преобразования объекта transformer
+   * Название преобразования разбирается один раз, дальше работает
+   *специализация AxisTransform без виртуальных вызовов
+   * @param vertexes Вектор, над которым будет происходить преобразование
+   * @param move Название преобразования
+   * @param value Значение, указывающий или шаг, или угол, или коэффициент
+   *масштабирования
+   ************************************************************/
+  void TransformModel(VertexArray& vertexes, Movement move, double val);
+
+  /************************************************************
+   * @brief Метод преобразования массива точек
+   *
+   * Точки копируются в VertexArray, преобразуются и записываются обратно
    * @param vertexes Вектор, над которым будет происходить преобразование
    * @param move Название преобразования
    * @param value Значение, указывающий или шаг, или угол, или коэффициент
@@ -53,14 +70,47 @@ class ManipulationFacade {
    ************************************************************/
   void TransformModel(std::vector<Point>& vertexes, Movement move, double val);
 
+  /************************************************************
+   * @brief Метод пакетного преобразования модели
+   *
+   * Преобразования сворачиваются в одну матрицу, которая применяется к
+   *вершинам за один проход. Единственное преобразование выполняется
+   *стратегией, как в TransformModel.
+   * @param vertexes Вектор, над которым будет происходить преобразование
+   * @param operations Преобразования в порядке применения
+   ************************************************************/
+  void TransformBatch(VertexArray& vertexes,
+                      const std::vector<TransformOperation>& operations);
+
+  /************************************************************
+   * @brief Метод для выбора политики выполнения
+   *
+   * Модели от policy.threshold вершин преобразуются и нормализуются
+   *параллельно в общем пуле потоков, меньшие - в текущем потоке.
+   * @param policy Политика выполнения
+   ************************************************************/
+  void setExecutionPolicy(const ExecutionPolicy& policy);
+
   /************************************************************
    * @brief Метод для нормализации модели
    *
    * Метод нормализует модель, то есть централизует и уменьшает масштаб,чтобы
-   *модель была в экране
+   *модель была в экране. Параллелепипед модели ищется параллельно векторизованными ядрами
+   *min/max, затем центрирование и масштабирование выполняются одним
+   *проходом v * scale + offset.
+   * @param vertexes Вектор, который нормализуем
+   ************************************************************/
+  void Normalization(VertexArray& vertexes);
+
+  /************************************************************
+   * @brief Метод для нормализации модели по известному параллелепипеду
+   *
+   * Используется, когда параллелепипед уже посчитан, например во время
+   *разбора файла, и проход поиска min/max не нужен.
    * @param vertexes Вектор, который нормализуем
+   * @param bounds Параллелепипед всех вершин vertexes
    ************************************************************/
-  void Normalization(std::vector<Point>& vertexes);
+  void Normalization(VertexArray& vertexes, const Bounds& bounds);
 };
 
 }  // namespace s21
@@ -0,0 +1,142 @@
+#include "edge_table.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "../concurrency/thread_pool.hpp"
+
+/************************************************************
+ * @file edge_table.cpp
+ * @brief Таблица уникальных ребер 3д модели
+ ************************************************************/
+
+namespace {
+
+/************************************************************
+ * @brief Минимальное количество индексов на одну часть при построении
+ ************************************************************/
+constexpr std::size_t kMinChunkIndexes = 1 << 16;
+
+/************************************************************
+ * @brief Ребро, упакованное в одно число: старшие 32 бита - меньший номер
+ ************************************************************/
+using EdgeKey = std::uint64_t;
+
+EdgeKey packEdge(std::uint32_t a, std::uint32_t b) {
+  if (a > b) std::swap(a, b);
+  return static_cast<EdgeKey>(a) << 32 | b;
+}
+
+std::size_t shardOf(EdgeKey key, std::size_t shards) {
+  return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) %
+         shards;
+}
+
+/************************************************************
+ * @brief Раскладывает ребра полигонов [first, last) по корзинам row
+ * @details Номера вершин вне [0, vertex_count) пропускаются
+ ************************************************************/
+void collectEdges(const s21::FaceArray& faces, std::size_t first,
+                  std::size_t last, std::size_t vertex_count,
+                  std::vector<EdgeKey>* row, std::size_t shards) {
+  for (std::size_t i = first; i < last; i++) {
+    s21::Face record = faces[i];
+    s21::IndexSpan face = record.indexes;
+    std::size_t n = face.size();
+    if (n < 2) continue;
+    // Ломаная не замыкается: ребра последней вершины с первой у нее нет
+    std::size_t count = n == 2 || record.open ? n - 1 : n;
+    for (std::size_t k = 0; k < count; k++) {
+      int a = face[k], b = face[(k + 1) % n];
+      if (a < 0 || b < 0 || a == b ||
+          static_cast<std::size_t>(a) >= vertex_count ||
+          static_cast<std::size_t>(b) >= vertex_count) {
+        continue;
+      }
+      EdgeKey key = packEdge(static_cast<std::uint32_t>(a),
+                             static_cast<std::uint32_t>(b));
+      row[shardOf(key, shards)].push_back(key);
+    }
+  }
+}
+
+}  // namespace
+
+s21::EdgeBuilder::EdgeBuilder(std::size_t shards)
+    : shards_(shards != 0 ? shards : ThreadPool::shared().size()) {}
+
+void s21::EdgeBuilder::addFaces(const FaceArray& faces) {
+  collectEdges(faces, 0, faces.size(), SIZE_MAX >> 1, shards_.data(),
+               shards_.size());
+}
+
+std::size_t s21::EdgeBuilder::size() const {
+  std::size_t total = 0;
+  for (const std::vector<std::uint64_t>& shard : shards_) total += shard.size();
+  return total;
+}
+
+void s21::EdgeTable::build(const FaceArray& faces, std::size_t vertex_count) {
+  edges_.clear();
+  if (faces.empty()) return;
+  ThreadPool& pool = ThreadPool::shared();
+  std::size_t chunks = std::clamp<std::size_t>(
+      faces.indexCount() / kMinChunkIndexes, 1, pool.size() * 4);
+  chunks = std::min(chunks, faces.size());
+  std::size_t shards = chunks;
+
+  // Каждая часть полигонов раскладывает свои ребра по корзинам: корзина
+  // выбирается хэшем ребра, поэтому одинаковые ребра из разных частей
+  // попадают в один и тот же столбец shards.
+  std::vector<std::vector<EdgeKey>> buckets(chunks * shards);
+  pool.parallelFor(chunks, [&](std::size_t chunk) {
+    std::size_t first = faces.size() * chunk / chunks;
+    std::size_t last = faces.size() * (chunk + 1) / chunks;
+    collectEdges(faces, first, last, vertex_count, &buckets[chunk * shards],
+                 shards);
+  });
+  merge(buckets, chunks, shards, vertex_count);
+}
+
+void s21::EdgeTable::build(EdgeBuilder& builder, std::size_t vertex_count) {
+  edges_.clear();
+  merge(builder.shards_, 1, builder.shards_.size(), vertex_count);
+}
+
+void s21::EdgeTable::merge(std::vector<std::vector<EdgeKey>>& buckets,
+                           std::size_t chunks, std::size_t shards,
+                           std::size_t vertex_count) {
+  std::vector<std::vector<EdgeKey>> unique(shards);
+  ThreadPool::shared().parallelFor(shards, [&](std::size_t shard) {
+    std::vector<EdgeKey>& keys = unique[shard];
+    std::size_t total = 0;
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+      total += buckets[chunk * shards + shard].size();
+    }
+    keys.reserve(total);
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+      std::vector<EdgeKey>& bucket = buckets[chunk * shards + shard];
+      keys.insert(keys.end(), bucket.begin(), bucket.end());
+      std::vector<EdgeKey>().swap(bucket);
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    // Ключи отсортированы по меньшему номеру, поэтому ребра с вершинами
+    // вне модели нельзя отрезать хвостом - проверяется каждый ключ
+    keys.erase(std::remove_if(keys.begin(), keys.end(),
+                              [vertex_count](EdgeKey key) {
+                                return (key & 0xFFFFFFFFu) >= vertex_count;
+                              }),
+               keys.end());
+  });
+
+  std::size_t total = 0;
+  for (const std::vector<EdgeKey>& keys : unique) total += keys.size();
+  edges_.reserve(total);
+  for (const std::vector<EdgeKey>& keys : unique) {
+    for (EdgeKey key : keys) {
+      edges_.push_back(Edge{static_cast<std::uint32_t>(key >> 32),
+                            static_cast<std::uint32_t>(key)});
+    }
+  }
+}
@@ -0,0 +1,130 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_EDGE_TABLE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_EDGE_TABLE_HPP_
+
+/************************************************************
+ * @file edge_table.hpp
+ * @brief Таблица уникальных ребер 3д модели
+ ************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "face_array.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Ребро между двумя вершинами
+ * @details Номера вершин отсчитываются от нуля, a < b
+ ************************************************************/
+struct Edge {
+  std::uint32_t a, b;
+};
+
+/************************************************************
+ * @brief Класс для накопления ребер по мере разбора файла
+ *
+ * Полигоны добавляются пачками, пока они еще в кэше процессора, а ребра
+ *сразу раскладываются по корзинам. EdgeTable::build(builder, ...)
+ *сортирует корзины параллельно и убирает повторы. Индексы больше
+ *количества вершин отбрасываются только при построении таблицы, потому
+ *что вершины могут быть объявлены после полигона.
+ ************************************************************/
+class EdgeBuilder {
+ public:
+  /************************************************************
+   * @brief Конструктор
+   * @param shards Количество корзин, 0 - по размеру общего пула потоков
+   ************************************************************/
+  explicit EdgeBuilder(std::size_t shards = 0);
+
+  /************************************************************
+   * @brief Метод для добавления ребер полигонов
+   * @param faces Полигоны, индексы вершин отсчитываются от нуля
+   * @return void
+   ************************************************************/
+  void addFaces(const FaceArray& faces);
+
+  /************************************************************
+   * @brief Количество добавленных ребер с повторами
+   ************************************************************/
+  std::size_t size() const;
+
+ private:
+  friend class EdgeTable;
+  std::vector<std::vector<std::uint64_t>> shards_;
+};
+
+/************************************************************
+ * @brief Класс для хранения уникальных ребер модели
+ *
+ * Каждое ребро, общее для нескольких полигонов, хранится один раз, поэтому
+ *каркас рисуется одним вызовом GL_LINES без повторов, а количество ребер
+ *равно размеру таблицы. Ребра лежат подряд парами uint32 и могут
+ *использоваться как индексный буфер.
+ ************************************************************/
+class EdgeTable {
+ public:
+  /************************************************************
+   * @brief Метод для построения таблицы по полигонам
+   *
+   * Полигон из n > 2 вершин дает n ребер (включая замыкающее), из двух
+   *вершин - одно ребро. Ребра с номерами вершин вне [0, vertex_count) и
+   *вырожденные ребра пропускаются. Полигоны обрабатываются параллельно в
+   *общем пуле потоков.
+   * @param faces Полигоны, индексы вершин отсчитываются от нуля
+   * @param vertex_count Количество вершин модели
+   * @return void
+   ************************************************************/
+  void build(const FaceArray& faces, std::size_t vertex_count);
+
+  /************************************************************
+   * @brief Метод для построения таблицы по накопленным ребрам
+   * @details Корзины builder опустошаются
+   * @param builder Ребра, накопленные по мере разбора
+   * @param vertex_count Количество вершин модели
+   * @return void
+   ************************************************************/
+  void build(EdgeBuilder& builder, std::size_t vertex_count);
+
+  /************************************************************
+   * @brief Метод для удаления всех ребер
+   * @return void
+   ************************************************************/
+  void clear() { edges_.clear(); }
+
+  /************************************************************
+   * @brief Количество ребер
+   ************************************************************/
+  std::size_t size() const { return edges_.size(); }
+
+  /************************************************************
+   * @brief Проверка на отсутствие ребер
+   ************************************************************/
+  bool empty() const { return edges_.empty(); }
+
+  /************************************************************
+   * @brief Ребро по номеру
+   ************************************************************/
+  const Edge& operator[](std::size_t i) const { return edges_[i]; }
+
+  /************************************************************
+   * @brief Ребра подряд: a0 b0 a1 b1 ...
+   ************************************************************/
+  const Edge* data() const { return edges_.data(); }
+
+  std::vector<Edge>::const_iterator begin() const { return edges_.begin(); }
+  std::vector<Edge>::const_iterator end() const { return edges_.end(); }
+
+ private:
+  void merge(std::vector<std::vector<std::uint64_t>>& buckets,
+             std::size_t chunks, std::size_t shards,
+             std::size_t vertex_count);
+
+  std::vector<Edge> edges_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_EDGE_TABLE_HPP_
@@ -0,0 +1,129 @@
+#include "face_array.hpp"
+
+#include <algorithm>
+#include <utility>
+
+/************************************************************
+ * @file face_array.cpp
+ * @brief Хранение полигонов 3д модели в сжатом виде (CSR)
+ ************************************************************/
+
+bool s21::operator==(const IndexSpan& lhs, const IndexSpan& rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+bool s21::operator==(const IndexSpan& lhs, const std::vector<int>& rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+s21::FaceArray::FaceArray() : offsets_{0}, indexes_{} {}
+
+s21::FaceArray::FaceArray(FaceArray&& other) noexcept
+    : offsets_{std::move(other.offsets_)},
+      indexes_{std::move(other.indexes_)},
+      open_{std::move(other.open_)} {
+  // Перемещенный вектор пуст, а size() ждет хотя бы одну границу
+  other.offsets_.assign(1, 0);
+}
+
+s21::FaceArray& s21::FaceArray::operator=(FaceArray&& other) noexcept {
+  if (this == &other) return *this;
+  offsets_ = std::move(other.offsets_);
+  indexes_ = std::move(other.indexes_);
+  open_ = std::move(other.open_);
+  other.offsets_.assign(1, 0);
+  other.indexes_.clear();
+  other.open_.clear();
+  return *this;
+}
+
+void s21::FaceArray::clear() {
+  offsets_.resize(1);
+  indexes_.clear();
+  open_.clear();
+}
+
+void s21::FaceArray::reserve(std::size_t faces, std::size_t indexes) {
+  offsets_.reserve(faces + 1);
+  indexes_.reserve(indexes);
+}
+
+void s21::FaceArray::push_back(const std::vector<int>& indexes) {
+  indexes_.insert(indexes_.end(), indexes.begin(), indexes.end());
+  closeFace();
+}
+
+void s21::FaceArray::append(const FaceArray& other) {
+  std::size_t faces = size();
+  std::uint64_t base = indexes_.size();
+  indexes_.insert(indexes_.end(), other.indexes_.begin(), other.indexes_.end());
+  offsets_.reserve(offsets_.size() + other.size());
+  for (std::size_t i = 1; i < other.offsets_.size(); i++) {
+    offsets_.push_back(base + other.offsets_[i]);
+  }
+  if (open_.empty() && other.open_.empty()) return;
+  open_.resize(faces, 0);
+  if (other.open_.empty()) {
+    open_.resize(size(), 0);
+  } else {
+    open_.insert(open_.end(), other.open_.begin(), other.open_.end());
+  }
+}
+
+void s21::FaceArray::assign(std::vector<std::uint64_t> offsets,
+                            std::vector<int> indexes,
+                            std::vector<std::uint8_t> open) {
+  offsets_ = std::move(offsets);
+  indexes_ = std::move(indexes);
+  open_ = std::move(open);
+  if (offsets_.empty()) offsets_.push_back(0);
+  if (!open_.empty()) open_.resize(size(), 0);
+}
+
+void s21::FaceArray::pushOpen(bool open) {
+  // Полигоны до первой ломаной флагов не имели: все они замкнутые
+  open_.resize(size() - 1, 0);
+  open_.push_back(open);
+}
+
+s21::FaceValidation s21::FaceArray::validate(std::size_t vertex_count,
+                                             InvalidFaces mode) {
+  FaceValidation report;
+  auto valid = [vertex_count](int index) {
+    return index >= 0 && static_cast<std::size_t>(index) < vertex_count;
+  };
+  // Полигоны сдвигаются к началу массивов по мере удаления индексов:
+  // write никогда не обгоняет чтение, поэтому проход идет на месте
+  std::size_t write = 0, faces = 0;
+  std::uint64_t begin = offsets_[0];
+  for (std::size_t i = 1; i < offsets_.size(); i++) {
+    std::uint64_t end = offsets_[i];
+    std::size_t invalid = static_cast<std::size_t>(
+        std::count_if(indexes_.begin() + begin, indexes_.begin() + end,
+                      [&](int index) { return !valid(index); }));
+    std::size_t size = end - begin;
+    bool keep = invalid == 0 ||
+                (mode == InvalidFaces::kRepair && size - invalid >= 2);
+    report.invalid_indexes += invalid;
+    if (invalid == 0 && write == begin) {
+      // До первой ошибки полигоны остаются на своих местах
+      write = end;
+      if (!open_.empty()) open_[faces] = open_[i - 1];
+      offsets_[++faces] = write;
+    } else if (!keep) {
+      report.rejected_faces++;
+    } else {
+      if (invalid != 0) report.repaired_faces++;
+      for (std::uint64_t k = begin; k < end; k++) {
+        if (valid(indexes_[k])) indexes_[write++] = indexes_[k];
+      }
+      if (!open_.empty()) open_[faces] = open_[i - 1];
+      offsets_[++faces] = write;
+    }
+    begin = end;
+  }
+  offsets_.resize(faces + 1);
+  indexes_.resize(write);
+  if (!open_.empty()) open_.resize(faces);
+  return report;
+}
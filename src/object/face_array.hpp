@@ -0,0 +1,324 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_FACE_ARRAY_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_FACE_ARRAY_HPP_
+
+/************************************************************
+ * @file face_array.hpp
+ * @brief Хранение полигонов 3д модели в сжатом виде (CSR)
+ ************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Индексы вершин одного полигона без копирования
+ *
+ * Указывает на участок общего массива индексов FaceArray и действителен,
+ *пока FaceArray не изменяется.
+ ************************************************************/
+class IndexSpan {
+ public:
+  using value_type = int;
+  using iterator = const int*;
+  using const_iterator = const int*;
+
+  IndexSpan(const int* data, std::size_t size) : data_{data}, size_{size} {}
+
+  /************************************************************
+   * @brief Количество индексов
+   ************************************************************/
+  std::size_t size() const { return size_; }
+
+  /************************************************************
+   * @brief Проверка на отсутствие индексов
+   ************************************************************/
+  bool empty() const { return size_ == 0; }
+
+  /************************************************************
+   * @brief Индекс по номеру без проверки границ
+   ************************************************************/
+  int operator[](std::size_t i) const { return data_[i]; }
+
+  /************************************************************
+   * @brief Индекс по номеру с проверкой границ
+   * @details Бросает std::out_of_range
+   ************************************************************/
+  int at(std::size_t i) const {
+    if (i >= size_) throw std::out_of_range("IndexSpan::at");
+    return data_[i];
+  }
+
+  const int* begin() const { return data_; }
+  const int* end() const { return data_ + size_; }
+
+ private:
+  const int* data_;
+  std::size_t size_;
+};
+
+bool operator==(const IndexSpan& lhs, const IndexSpan& rhs);
+bool operator==(const IndexSpan& lhs, const std::vector<int>& rhs);
+
+/************************************************************
+ * @brief Полигон, возвращаемый FaceArray
+ ************************************************************/
+struct Face {
+  /************************************************************
+   * @brief Последовательность вершин
+   ************************************************************/
+  IndexSpan indexes;
+
+  /************************************************************
+   * @brief Открытая ломаная (запись l): последняя вершина не соединяется
+   *с первой
+   ************************************************************/
+  bool open = false;
+};
+
+/************************************************************
+ * @brief Что делать с полигоном, в котором есть недопустимые индексы
+ *
+ * kRepair - недопустимые индексы удаляются из полигона, полигон остается,
+ *если в нем осталось хотя бы два индекса;
+ * kReject - полигон удаляется целиком
+ ************************************************************/
+enum class InvalidFaces { kRepair, kReject };
+
+/************************************************************
+ * @brief Результат проверки индексов полигонов
+ ************************************************************/
+struct FaceValidation {
+  /************************************************************
+   * @brief Количество индексов вне [0, vertex_count)
+   ************************************************************/
+  std::size_t invalid_indexes = 0;
+
+  /************************************************************
+   * @brief Количество полигонов, из которых удалены индексы
+   ************************************************************/
+  std::size_t repaired_faces = 0;
+
+  /************************************************************
+   * @brief Количество удаленных полигонов
+   ************************************************************/
+  std::size_t rejected_faces = 0;
+
+  /************************************************************
+   * @brief Все ли индексы были допустимы
+   ************************************************************/
+  bool clean() const { return invalid_indexes == 0; }
+};
+
+/************************************************************
+ * @brief Класс для хранения полигонов модели
+ *
+ * Индексы всех полигонов лежат подряд в одном массиве, а offsets[i] и
+ *offsets[i + 1] ограничивают индексы i-го полигона. Добавление полигона не
+ *выделяет память под каждый полигон отдельно, а обход идет по памяти
+ *подряд.
+ *
+ * Индексы вершин отсчитываются от нуля. После validate все индексы лежат в
+ *[0, vertex_count), поэтому отрисовка и экспорт обращаются к вершинам без
+ *проверок.
+ *
+ * Ломаные из записей l хранятся вместе с полигонами и отмечаются флагом
+ *open. Флаги заводятся только после первой ломаной, поэтому модели из одних
+ *полигонов не тратят на них памяти.
+ ************************************************************/
+class FaceArray {
+ public:
+  /************************************************************
+   * @brief Итератор по полигонам, возвращает Face по значению
+   ************************************************************/
+  class const_iterator {
+   public:
+    const_iterator(const FaceArray* array, std::size_t index)
+        : array_{array}, index_{index} {}
+    Face operator*() const { return (*array_)[index_]; }
+    const_iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+    bool operator==(const const_iterator& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return index_ != other.index_;
+    }
+
+   private:
+    const FaceArray* array_;
+    std::size_t index_;
+  };
+
+  /************************************************************
+   * @brief Конструктор по умолчанию
+   * @details Создает пустой массив полигонов
+   ************************************************************/
+  FaceArray();
+
+  FaceArray(const FaceArray& other) = default;
+  FaceArray& operator=(const FaceArray& other) = default;
+
+  /************************************************************
+   * @brief Конструктор перемещения
+   * @details Забирает массивы без копирования, other остается пустым
+   *массивом полигонов с единственной границей 0
+   ************************************************************/
+  FaceArray(FaceArray&& other) noexcept;
+
+  /************************************************************
+   * @brief Оператор присваивания перемещением
+   * @details Как и конструктор перемещения, оставляет other пустым
+   ************************************************************/
+  FaceArray& operator=(FaceArray&& other) noexcept;
+
+  /************************************************************
+   * @brief Индекс, который ставится вместо нечитаемого или нулевого
+   * @details Лежит вне любой модели, поэтому validate учитывает его как
+   *недопустимый
+   ************************************************************/
+  static constexpr int kInvalidIndex = -1;
+
+  /************************************************************
+   * @brief Количество полигонов
+   ************************************************************/
+  std::size_t size() const { return offsets_.size() - 1; }
+
+  /************************************************************
+   * @brief Проверка на отсутствие полигонов
+   ************************************************************/
+  bool empty() const { return size() == 0; }
+
+  /************************************************************
+   * @brief Суммарное количество индексов во всех полигонах
+   ************************************************************/
+  std::size_t indexCount() const { return indexes_.size(); }
+
+  /************************************************************
+   * @brief Метод для удаления всех полигонов
+   * @return void
+   ************************************************************/
+  void clear();
+
+  /************************************************************
+   * @brief Метод для резервирования памяти
+   * @param faces Ожидаемое количество полигонов
+   * @param indexes Ожидаемое количество индексов
+   * @return void
+   ************************************************************/
+  void reserve(std::size_t faces, std::size_t indexes);
+
+  /************************************************************
+   * @brief Метод для добавления индекса в текущий (незакрытый) полигон
+   * @param index Индекс вершины
+   * @return void
+   ************************************************************/
+  void addIndex(int index) { indexes_.push_back(index); }
+
+  /************************************************************
+   * @brief Метод для завершения текущего полигона
+   * @details Все индексы, добавленные после прошлого вызова, образуют полигон
+   * @param open Открытая ли это ломаная
+   * @return void
+   ************************************************************/
+  void closeFace(bool open = false) {
+    offsets_.push_back(indexes_.size());
+    if (open || !open_.empty()) pushOpen(open);
+  }
+
+  /************************************************************
+   * @brief Метод для добавления полигона целиком
+   * @param indexes Индексы вершин
+   * @return void
+   ************************************************************/
+  void push_back(const std::vector<int>& indexes);
+
+  /************************************************************
+   * @brief Метод для добавления в конец всех полигонов другого массива
+   * @param other Массив полигонов
+   * @return void
+   ************************************************************/
+  void append(const FaceArray& other);
+
+  /************************************************************
+   * @brief Полигон по номеру без проверки границ
+   ************************************************************/
+  Face operator[](std::size_t i) const {
+    return Face{IndexSpan(indexes_.data() + offsets_[i],
+                          offsets_[i + 1] - offsets_[i]),
+                isOpen(i)};
+  }
+
+  /************************************************************
+   * @brief Открытая ли ломаная полигон с номером i
+   ************************************************************/
+  bool isOpen(std::size_t i) const { return !open_.empty() && open_[i] != 0; }
+
+  /************************************************************
+   * @brief Полигон по номеру с проверкой границ
+   * @details Бросает std::out_of_range
+   ************************************************************/
+  Face at(std::size_t i) const {
+    if (i >= size()) throw std::out_of_range("FaceArray::at");
+    return (*this)[i];
+  }
+
+  /************************************************************
+   * @brief Общий массив индексов
+   ************************************************************/
+  int* indexes() { return indexes_.data(); }
+  const int* indexes() const { return indexes_.data(); }
+
+  /************************************************************
+   * @brief Массив границ полигонов из size() + 1 элементов
+   ************************************************************/
+  const std::uint64_t* offsets() const { return offsets_.data(); }
+
+  /************************************************************
+   * @brief Флаги открытых ломаных по одному байту на полигон
+   * @return nullptr, если ломаных нет
+   ************************************************************/
+  const std::uint8_t* openFlags() const {
+    return open_.empty() ? nullptr : open_.data();
+  }
+
+  /************************************************************
+   * @brief Метод для замены содержимого готовыми массивами
+   * @param offsets Границы полигонов, offsets[0] == 0
+   * @param indexes Индексы вершин
+   * @param open Флаги открытых ломаных, пустой - ломаных нет
+   * @return void
+   ************************************************************/
+  void assign(std::vector<std::uint64_t> offsets, std::vector<int> indexes,
+              std::vector<std::uint8_t> open = {});
+
+  /************************************************************
+   * @brief Метод для проверки индексов после загрузки
+   *
+   * Полигоны с индексами вне [0, vertex_count) исправляются или удаляются
+   *за один проход по массиву индексов на месте.
+   * @param vertex_count Количество вершин модели
+   * @param mode Что делать с недопустимыми полигонами
+   * @return Количество найденных ошибок и исправленных полигонов
+   ************************************************************/
+  FaceValidation validate(std::size_t vertex_count,
+                          InvalidFaces mode = InvalidFaces::kRepair);
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size()); }
+
+ private:
+  void pushOpen(bool open);
+
+  std::vector<std::uint64_t> offsets_;
+  std::vector<int> indexes_;
+  std::vector<std::uint8_t> open_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_FACE_ARRAY_HPP_
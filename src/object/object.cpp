@@ -1,22 +1,60 @@
 #include "object.hpp"
 
+#include <algorithm>
+#include <limits>
+
 /************************************************************
  * @file object.cpp
  * @brief Классы для хранения информации о 3д объекте
  ************************************************************/
 
-s21::Point::Point() : x{0}, y{0}, z{0} {}
-
-s21::Point::Point(double x, double y, double z) : x{x}, y{y}, z{z} {}
-
-s21::Point::~Point() {}
-
-s21::Line::Line() : indexes{} {}
-
-s21::Line::Line(std::vector<int>& other) : indexes{other} {}
-
-s21::Line::~Line() {}
-
-s21::Object::Object() : vertexes{}, lines{} {}
+s21::Bounds::Bounds() { reset(); }
+
+void s21::Bounds::reset() {
+  double inf = std::numeric_limits<double>::infinity();
+  min = Point(inf, inf, inf);
+  max = Point(-inf, -inf, -inf);
+}
+
+void s21::Bounds::extend(const Point& p) {
+  min.x = std::min(min.x, p.x);
+  min.y = std::min(min.y, p.y);
+  min.z = std::min(min.z, p.z);
+  max.x = std::max(max.x, p.x);
+  max.y = std::max(max.y, p.y);
+  max.z = std::max(max.z, p.z);
+}
+
+void s21::Bounds::extend(const VertexArray& vertexes, std::size_t first,
+                         std::size_t last) {
+  const Scalar *x = vertexes.x(), *y = vertexes.y(), *z = vertexes.z();
+  last = std::min(last, vertexes.size());
+  for (std::size_t i = first; i < last; i++) {
+    min.x = std::min<double>(min.x, x[i]);
+    min.y = std::min<double>(min.y, y[i]);
+    min.z = std::min<double>(min.z, z[i]);
+    max.x = std::max<double>(max.x, x[i]);
+    max.y = std::max<double>(max.y, y[i]);
+    max.z = std::max<double>(max.z, z[i]);
+  }
+}
+
+void s21::Bounds::extend(const Bounds& other) {
+  if (other.empty()) return;
+  extend(other.min);
+  extend(other.max);
+}
+
+bool s21::Bounds::empty() const { return min.x > max.x; }
+
+s21::Point s21::Bounds::center() const {
+  return Point(min.x + (max.x - min.x) / 2, min.y + (max.y - min.y) / 2,
+               min.z + (max.z - min.z) / 2);
+}
+
+double s21::Bounds::extent() const {
+  return std::max({max.x - min.x, max.y - min.y, max.z - min.z});
+}
+
+s21::Object::Object() : vertexes{}, lines{}, edges{} {}
 
-s21::Object::~Object() {}
@@ -6,67 +6,78 @@
  * @brief Классы для хранения информации о 3д объекте
  ************************************************************/
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
+#include "edge_table.hpp"
+#include "face_array.hpp"
+#include "point.hpp"
+#include "vertex_array.hpp"
+
 namespace s21 {
 
 /************************************************************
- * @brief Класс для хранения координат
+ * @brief Класс для хранения ограничивающего параллелепипеда модели
  ************************************************************/
-class Point {
+class Bounds {
  public:
   /************************************************************
-   * @brief Координаты точки
+   * @brief Минимальные и максимальные координаты
    ************************************************************/
-  double x, y, z;
+  Point min, max;
 
   /************************************************************
-   * @brief Конструскор по умолчанию
-   * @details Обнуляет x, y и z
+   * @brief Конструктор по умолчанию
+   * @details Создает пустой параллелепипед
    ************************************************************/
-  Point();
+  Bounds();
 
   /************************************************************
-   * @brief Параметризированный конструскор
-   * @param x Координата x
-   * @param y Координата y
-   * @param z Координата z
+   * @brief Метод для очистки параллелепипеда
+   * @return void
    ************************************************************/
-  Point(double x, double y, double z);
+  void reset();
 
   /************************************************************
-   * @brief Деструктор
+   * @brief Метод для расширения параллелепипеда до точки
+   * @param p Точка
+   * @return void
    ************************************************************/
-  ~Point();
-};
+  void extend(const Point& p);
 
-/************************************************************
- * @brief Класс для хранения последовательности соединения вершин
- ************************************************************/
-class Line {
- public:
   /************************************************************
-   * @brief Последовательность вершин
+   * @brief Метод для расширения параллелепипеда до вершин
+   * @param vertexes Вершины
+   * @param first Номер первой вершины, которую нужно учесть
+   * @param last Номер вершины после последней учитываемой
+   * @return void
    ************************************************************/
-  std::vector<int> indexes;
+  void extend(const VertexArray& vertexes, std::size_t first = 0,
+              std::size_t last = SIZE_MAX);
 
   /************************************************************
-   * @brief Конструктор по умолчанию
-   * @details Инициализирует пустой вектор
+   * @brief Метод для объединения с другим параллелепипедом
+   * @param other Параллелепипед
+   * @return void
+   ************************************************************/
+  void extend(const Bounds& other);
+
+  /************************************************************
+   * @brief Проверка, учтена ли хотя бы одна точка
    ************************************************************/
-  Line();
+  bool empty() const;
 
   /************************************************************
-   * @brief Конструктор копирования
-   * @param other Вектор вершин;
+   * @brief Центр параллелепипеда
    ************************************************************/
-  Line(std::vector<int>& other);
+  Point center() const;
 
   /************************************************************
-   * @brief Деструктор
+   * @brief Наибольшая из длин сторон
    ************************************************************/
-  ~Line();
+  double extent() const;
 };
 
 /************************************************************
@@ -77,22 +88,40 @@ class Object {
   /************************************************************
    * @brief Вершины 3д модели
    ************************************************************/
-  std::vector<Point> vertexes;
+  VertexArray vertexes;
 
   /************************************************************
    * @brief Полигоны (фасеты) 3д модели
    ************************************************************/
-  std::vector<Line> lines;
+  FaceArray lines;
+
+  /************************************************************
+   * @brief Уникальные ребра 3д модели
+   * @details Строятся по lines после загрузки модели
+   ************************************************************/
+  EdgeTable edges;
 
   /************************************************************
    * @brief Конструктор по умолчанию
    ************************************************************/
   Object();
 
+  Object(const Object& other) = default;
+  Object& operator=(const Object& other) = default;
+
   /************************************************************
-   * @brief Деструктор
+   * @brief Конструктор перемещения
+   * @details Забирает массивы без копирования, other остается пустым
    ************************************************************/
-  ~Object();
+  Object(Object&& other) noexcept = default;
+
+  /************************************************************
+   * @brief Оператор присваивания перемещением
+   * @details Забирает массивы без копирования, other остается пустым
+   ************************************************************/
+  Object& operator=(Object&& other) noexcept = default;
+
+  ~Object() = default;
 };
 }  // namespace s21
 
@@ -0,0 +1,40 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_POINT_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_POINT_HPP_
+
+/************************************************************
+ * @file point.hpp
+ * @brief Координаты одной точки
+ ************************************************************/
+
+namespace s21 {
+
+/************************************************************
+ * @brief Класс для хранения координат
+ *
+ * Тривиально копируемый, поэтому массивы точек копируются через memcpy.
+ ************************************************************/
+class Point {
+ public:
+  /************************************************************
+   * @brief Координаты точки
+   ************************************************************/
+  double x, y, z;
+
+  /************************************************************
+   * @brief Конструскор по умолчанию
+   * @details Обнуляет x, y и z
+   ************************************************************/
+  constexpr Point() : x{0}, y{0}, z{0} {}
+
+  /************************************************************
+   * @brief Параметризированный конструскор
+   * @param x Координата x
+   * @param y Координата y
+   * @param z Координата z
+   ************************************************************/
+  constexpr Point(double x, double y, double z) : x{x}, y{y}, z{z} {}
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_POINT_HPP_
@@ -0,0 +1,55 @@
+#include "vertex_array.hpp"
+
+#include <algorithm>
+
+/************************************************************
+ * @file vertex_array.cpp
+ * @brief Хранение вершин 3д модели в виде структуры массивов
+ ************************************************************/
+
+s21::VertexArray::VertexArray(const std::vector<Point>& points) {
+  reserve(points.size());
+  for (const Point& p : points) push_back(p);
+}
+
+void s21::VertexArray::clear() {
+  x_.clear();
+  y_.clear();
+  z_.clear();
+}
+
+void s21::VertexArray::reserve(std::size_t count) {
+  x_.reserve(count);
+  y_.reserve(count);
+  z_.reserve(count);
+}
+
+void s21::VertexArray::resize(std::size_t count) {
+  x_.resize(count);
+  y_.resize(count);
+  z_.resize(count);
+}
+
+void s21::VertexArray::append(const VertexArray& other) {
+  x_.insert(x_.end(), other.x_.begin(), other.x_.end());
+  y_.insert(y_.end(), other.y_.begin(), other.y_.end());
+  z_.insert(z_.end(), other.z_.begin(), other.z_.end());
+}
+
+std::vector<s21::Point> s21::VertexArray::toPoints() const {
+  std::vector<Point> points;
+  points.reserve(size());
+  for (std::size_t i = 0; i < size(); i++) points.push_back((*this)[i]);
+  return points;
+}
+
+std::vector<float> s21::VertexArray::interleaved(std::size_t first) const {
+  std::vector<float> buffer((size() - std::min(first, size())) * 3);
+  for (std::size_t i = first; i < size(); i++) {
+    std::size_t j = (i - first) * 3;
+    buffer[j] = static_cast<float>(x_[i]);
+    buffer[j + 1] = static_cast<float>(y_[i]);
+    buffer[j + 2] = static_cast<float>(z_[i]);
+  }
+  return buffer;
+}
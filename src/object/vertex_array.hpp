@@ -0,0 +1,216 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_VERTEX_ARRAY_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_VERTEX_ARRAY_HPP_
+
+/************************************************************
+ * @file vertex_array.hpp
+ * @brief Хранение вершин 3д модели в виде структуры массивов
+ ************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "point.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Тип координат в хранилище вершин
+ *
+ * По умолчанию double. Если при сборке определен S21_FLOAT32_VERTICES,
+ *координаты хранятся в float, что вдвое уменьшает память под вершины.
+ ************************************************************/
+#ifdef S21_FLOAT32_VERTICES
+using Scalar = float;
+#else
+using Scalar = double;
+#endif
+
+/************************************************************
+ * @brief Участок вершин VertexArray без копирования
+ *
+ * Указатели на первые элементы участка в массивах x, y и z. Действителен,
+ *пока размер VertexArray не меняется.
+ ************************************************************/
+struct VertexRange {
+  Scalar* x;
+  Scalar* y;
+  Scalar* z;
+  std::size_t size;
+};
+
+/************************************************************
+ * @brief Класс для хранения вершин модели
+ *
+ * Координаты x, y и z лежат в трех отдельных непрерывных массивах, поэтому
+ *циклы преобразований проходят по памяти подряд и векторизуются.
+ *Доступ к отдельной вершине возвращает Point по значению.
+ ************************************************************/
+class VertexArray {
+ public:
+  /************************************************************
+   * @brief Итератор по вершинам, возвращает Point по значению
+   ************************************************************/
+  class const_iterator {
+   public:
+    const_iterator(const VertexArray* array, std::size_t index)
+        : array_{array}, index_{index} {}
+    Point operator*() const { return (*array_)[index_]; }
+    const_iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+    bool operator==(const const_iterator& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const const_iterator& other) const {
+      return index_ != other.index_;
+    }
+
+   private:
+    const VertexArray* array_;
+    std::size_t index_;
+  };
+
+  /************************************************************
+   * @brief Конструктор по умолчанию
+   * @details Создает пустое хранилище
+   ************************************************************/
+  VertexArray() = default;
+
+  /************************************************************
+   * @brief Конструктор из массива точек
+   * @param points Точки
+   ************************************************************/
+  explicit VertexArray(const std::vector<Point>& points);
+
+  /************************************************************
+   * @brief Количество вершин
+   ************************************************************/
+  std::size_t size() const { return x_.size(); }
+
+  /************************************************************
+   * @brief Проверка на отсутствие вершин
+   ************************************************************/
+  bool empty() const { return x_.empty(); }
+
+  /************************************************************
+   * @brief Метод для удаления всех вершин
+   * @return void
+   ************************************************************/
+  void clear();
+
+  /************************************************************
+   * @brief Метод для резервирования памяти
+   * @param count Ожидаемое количество вершин
+   * @return void
+   ************************************************************/
+  void reserve(std::size_t count);
+
+  /************************************************************
+   * @brief Метод для изменения количества вершин
+   * @details Новые вершины равны (0, 0, 0)
+   * @param count Количество вершин
+   * @return void
+   ************************************************************/
+  void resize(std::size_t count);
+
+  /************************************************************
+   * @brief Метод для добавления вершины в конец
+   * @param x Координата x
+   * @param y Координата y
+   * @param z Координата z
+   * @return void
+   ************************************************************/
+  void emplace_back(double x, double y, double z) {
+    x_.push_back(static_cast<Scalar>(x));
+    y_.push_back(static_cast<Scalar>(y));
+    z_.push_back(static_cast<Scalar>(z));
+  }
+
+  /************************************************************
+   * @brief Метод для добавления вершины в конец
+   * @param p Вершина
+   * @return void
+   ************************************************************/
+  void push_back(const Point& p) { emplace_back(p.x, p.y, p.z); }
+
+  /************************************************************
+   * @brief Метод для добавления в конец всех вершин другого хранилища
+   * @param other Хранилище
+   * @return void
+   ************************************************************/
+  void append(const VertexArray& other);
+
+  /************************************************************
+   * @brief Вершина по номеру без проверки границ
+   ************************************************************/
+  Point operator[](std::size_t i) const { return Point(x_[i], y_[i], z_[i]); }
+
+  /************************************************************
+   * @brief Вершина по номеру с проверкой границ
+   * @details Бросает std::out_of_range
+   ************************************************************/
+  Point at(std::size_t i) const {
+    return Point(x_.at(i), y_.at(i), z_.at(i));
+  }
+
+  /************************************************************
+   * @brief Метод для изменения вершины
+   * @param i Номер вершины
+   * @param p Новые координаты
+   * @return void
+   ************************************************************/
+  void set(std::size_t i, const Point& p) {
+    x_[i] = static_cast<Scalar>(p.x);
+    y_[i] = static_cast<Scalar>(p.y);
+    z_[i] = static_cast<Scalar>(p.z);
+  }
+
+  /************************************************************
+   * @brief Непрерывные массивы координат
+   ************************************************************/
+  Scalar* x() { return x_.data(); }
+  Scalar* y() { return y_.data(); }
+  Scalar* z() { return z_.data(); }
+  const Scalar* x() const { return x_.data(); }
+  const Scalar* y() const { return y_.data(); }
+  const Scalar* z() const { return z_.data(); }
+
+  /************************************************************
+   * @brief Участок вершин [first, last)
+   ************************************************************/
+  VertexRange range(std::size_t first, std::size_t last) {
+    return VertexRange{x_.data() + first, y_.data() + first, z_.data() + first,
+                       last - first};
+  }
+
+  /************************************************************
+   * @brief Все вершины
+   ************************************************************/
+  VertexRange range() { return range(0, size()); }
+
+  /************************************************************
+   * @brief Метод для получения вершин в виде массива точек
+   * @return Массив точек
+   ************************************************************/
+  std::vector<Point> toPoints() const;
+
+  /************************************************************
+   * @brief Метод для получения вершин в виде x0 y0 z0 x1 y1 z1 ...
+   *
+   * Такой буфер float3 можно сразу загружать в видеопамять.
+   * @param first Номер первой вершины, чтобы догрузить только новые
+   * @return Массив из 3 * (size() - first) чисел
+   ************************************************************/
+  std::vector<float> interleaved(std::size_t first = 0) const;
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size()); }
+
+ private:
+  std::vector<Scalar> x_, y_, z_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_VERTEX_ARRAY_HPP_
@@ -0,0 +1,323 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_PARSER_DIRECTIVES_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_PARSER_DIRECTIVES_HPP_
+
+/************************************************************
+ * @file directives.hpp
+ * @brief Таблица записей obj файла и их разбор
+ *
+ * Каждой записи (v, vn, vt, f, l, o, g, usemtl) соответствует значение
+ *Directive и специализация RecordParser. Выбор обработчика - один switch
+ *на строку, обработчики подставляются на этапе компиляции, поэтому в цикле
+ *разбора нет ни выделений памяти, ни виртуальных вызовов.
+ *
+ * Чтобы добавить новую запись, достаточно добавить значение в Directive,
+ *ключевое слово в classifyDirective, специализацию RecordParser и ветку в
+ *dispatchRecord.
+ ************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "../object/object.hpp"
+#include "tokenizer.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Позиции индексов, записанных относительно текущего числа вершин
+ *
+ * Номера в общем массиве индексов FaceArray. Нужны при параллельном
+ *разборе: часть файла знает только свои вершины, поэтому такие индексы
+ *сдвигаются при склейке частей.
+ ************************************************************/
+using RelativeIndexes = std::vector<std::size_t>;
+
+/************************************************************
+ * @brief Записи obj файла, которые понимает парсер
+ ************************************************************/
+enum class Directive {
+  kVertex,
+  kNormal,
+  kTexture,
+  kFace,
+  kLine,
+  kObject,
+  kGroup,
+  kMaterial,
+  kUnknown
+};
+
+/************************************************************
+ * @brief Прогресс разбора и флаг его отмены
+ *
+ * Поля обновляются потоком, который разбирает файл, пачками строк и могут
+ *читаться из любого другого потока.
+ ************************************************************/
+struct ParseProgress {
+  /************************************************************
+   * @brief Размер файла в байтах
+   ************************************************************/
+  std::atomic<std::size_t> total_bytes{0};
+
+  /************************************************************
+   * @brief Количество обработанных байт
+   ************************************************************/
+  std::atomic<std::size_t> bytes{0};
+
+  /************************************************************
+   * @brief Количество разобранных записей
+   ************************************************************/
+  std::atomic<std::size_t> records{0};
+
+  /************************************************************
+   * @brief Флаг отмены. Разбор прекращается при ближайшей проверке
+   ************************************************************/
+  std::atomic<bool> cancelled{false};
+
+  /************************************************************
+   * @brief Метод для сброса прогресса перед новым разбором
+   * @return void
+   ************************************************************/
+  void reset() {
+    total_bytes = 0;
+    bytes = 0;
+    records = 0;
+    cancelled = false;
+  }
+};
+
+/************************************************************
+ * @brief Обработчик пачки разобранных записей
+ *
+ * Получает объект с вершинами и полигонами, разобранными с прошлого
+ *вызова, и может забрать их (например, через std::move). После вызова
+ *объект очищается.
+ ************************************************************/
+using BatchHandler = std::function<void(Object& batch)>;
+
+/************************************************************
+ * @brief Состояние одного разбора
+ ************************************************************/
+struct ParseContext {
+  /************************************************************
+   * @brief Объект, в который сохраняется модель
+   ************************************************************/
+  Object& object;
+
+  /************************************************************
+   * @brief Куда записываются позиции относительных индексов
+   * @details nullptr, если позиции не нужны
+   ************************************************************/
+  RelativeIndexes* relative = nullptr;
+
+  /************************************************************
+   * @brief Куда сообщается прогресс разбора
+   * @details nullptr, если прогресс не нужен
+   ************************************************************/
+  ParseProgress* progress = nullptr;
+
+  /************************************************************
+   * @brief Обработчик пачек записей
+   * @details nullptr, если модель собирается целиком в object
+   ************************************************************/
+  const BatchHandler* batches = nullptr;
+
+  /************************************************************
+   * @brief Параллелепипед, до которого расширяется каждая вершина
+   * @details nullptr, если параллелепипед не нужен
+   ************************************************************/
+  Bounds* bounds = nullptr;
+
+  /************************************************************
+   * @brief Количество вершин, уже отданных обработчику пачек
+   ************************************************************/
+  std::size_t vertex_base = 0;
+
+  /************************************************************
+   * @brief Количество прочитанных нормалей (vn) и текстурных координат (vt)
+   ************************************************************/
+  std::size_t normals = 0;
+  std::size_t textures = 0;
+};
+
+/************************************************************
+ * @brief Функция для определения записи по ключевому слову
+ * @param keyword Первый токен строки
+ * @return Запись или Directive::kUnknown
+ ************************************************************/
+inline Directive classifyDirective(std::string_view keyword) {
+  switch (keyword.size()) {
+    case 1:
+      switch (keyword[0]) {
+        case 'v':
+          return Directive::kVertex;
+        case 'f':
+          return Directive::kFace;
+        case 'l':
+          return Directive::kLine;
+        case 'o':
+          return Directive::kObject;
+        case 'g':
+          return Directive::kGroup;
+        default:
+          return Directive::kUnknown;
+      }
+    case 2:
+      if (keyword == "vn") return Directive::kNormal;
+      if (keyword == "vt") return Directive::kTexture;
+      return Directive::kUnknown;
+    case 6:
+      return keyword == "usemtl" ? Directive::kMaterial : Directive::kUnknown;
+    default:
+      return Directive::kUnknown;
+  }
+}
+
+/************************************************************
+ * @brief Разбор записи, специализируется для каждого значения Directive
+ *
+ * Специализация содержит static void parse(ParseContext&, Tokenizer&);
+ *tokens указывает на начало аргументов записи. По умолчанию запись
+ *пропускается: так обрабатываются o, g и usemtl, которые не влияют на
+ *каркас модели.
+ ************************************************************/
+template <Directive D>
+struct RecordParser {
+  static void parse(ParseContext&, Tokenizer&) {}
+};
+
+/************************************************************
+ * @brief Вершина: v x y z [w]
+ ************************************************************/
+template <>
+struct RecordParser<Directive::kVertex> {
+  static void parse(ParseContext& context, Tokenizer& tokens) {
+    double x, y, z;
+    if (tokens.readDouble(x) && tokens.readDouble(y) && tokens.readDouble(z)) {
+      context.object.vertexes.emplace_back(x, y, z);
+      if (context.bounds != nullptr) {
+        context.bounds->extend(Point(static_cast<Scalar>(x),
+                                     static_cast<Scalar>(y),
+                                     static_cast<Scalar>(z)));
+      }
+    }
+  }
+};
+
+/************************************************************
+ * @brief Нормаль: vn x y z. Для каркаса сохраняется только их количество
+ ************************************************************/
+template <>
+struct RecordParser<Directive::kNormal> {
+  static void parse(ParseContext& context, Tokenizer&) { context.normals++; }
+};
+
+/************************************************************
+ * @brief Текстурная координата: vt u [v [w]]. Сохраняется только количество
+ ************************************************************/
+template <>
+struct RecordParser<Directive::kTexture> {
+  static void parse(ParseContext& context, Tokenizer&) { context.textures++; }
+};
+
+/************************************************************
+ * @brief Полигон: f v1[/vt1][/vn1] v2 ...
+ *
+ * Сохраняется индекс вершины, отсчитанный от нуля. Отрицательные индексы
+ *отсчитываются от последней прочитанной вершины. Индекс 0 недопустим в obj,
+ *поэтому он, как и нечитаемый токен, сохраняется как
+ *FaceArray::kInvalidIndex: такие индексы вместе с индексами вне модели
+ *отсеивает и подсчитывает FaceArray::validate.
+ ************************************************************/
+template <>
+struct RecordParser<Directive::kFace> {
+  static void parse(ParseContext& context, Tokenizer& tokens) {
+    readIndexes(context, tokens);
+    context.object.lines.closeFace();
+  }
+
+  /************************************************************
+   * @brief Метод для чтения индексов вершин записи в текущий полигон
+   * @return void
+   ************************************************************/
+  static void readIndexes(ParseContext& context, Tokenizer& tokens) {
+    Object& object = context.object;
+    FaceIndex index;
+    while (!tokens.atEnd()) {
+      if (!tokens.readFaceIndex(index)) {
+        object.lines.addIndex(FaceArray::kInvalidIndex);
+        continue;
+      }
+      if (index.vertex < 0) {
+        index.vertex += static_cast<int>(context.vertex_base +
+                                         object.vertexes.size());
+        if (context.relative != nullptr) {
+          context.relative->push_back(object.lines.indexCount());
+        }
+      } else {
+        index.vertex -= 1;
+      }
+      object.lines.addIndex(index.vertex);
+    }
+  }
+};
+
+/************************************************************
+ * @brief Ломаная: l v1[/vt1] v2 ...
+ *
+ * Хранится вместе с полигонами с флагом open, поэтому последняя вершина
+ *не соединяется с первой.
+ ************************************************************/
+template <>
+struct RecordParser<Directive::kLine> {
+  static void parse(ParseContext& context, Tokenizer& tokens) {
+    RecordParser<Directive::kFace>::readIndexes(context, tokens);
+    context.object.lines.closeFace(true);
+  }
+};
+
+/************************************************************
+ * @brief Метод для вызова обработчика записи
+ * @param directive Запись
+ * @param context Состояние разбора
+ * @param tokens Аргументы записи
+ * @return void
+ ************************************************************/
+inline void dispatchRecord(Directive directive, ParseContext& context,
+                           Tokenizer& tokens) {
+  switch (directive) {
+    case Directive::kVertex:
+      RecordParser<Directive::kVertex>::parse(context, tokens);
+      break;
+    case Directive::kNormal:
+      RecordParser<Directive::kNormal>::parse(context, tokens);
+      break;
+    case Directive::kTexture:
+      RecordParser<Directive::kTexture>::parse(context, tokens);
+      break;
+    case Directive::kFace:
+      RecordParser<Directive::kFace>::parse(context, tokens);
+      break;
+    case Directive::kLine:
+      RecordParser<Directive::kLine>::parse(context, tokens);
+      break;
+    case Directive::kObject:
+      RecordParser<Directive::kObject>::parse(context, tokens);
+      break;
+    case Directive::kGroup:
+      RecordParser<Directive::kGroup>::parse(context, tokens);
+      break;
+    case Directive::kMaterial:
+      RecordParser<Directive::kMaterial>::parse(context, tokens);
+      break;
+    case Directive::kUnknown:
+      break;
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_PARSER_DIRECTIVES_HPP_
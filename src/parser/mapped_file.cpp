@@ -0,0 +1,79 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <utility>
+
+/************************************************************
+ * @file mapped_file.cpp
+ * @brief Отображение файла в память только для чтения
+ ************************************************************/
+
+s21::MappedFile::MappedFile(const std::string& filename) { open(filename); }
+
+s21::MappedFile::MappedFile(MappedFile&& other) noexcept {
+  *this = std::move(other);
+}
+
+s21::MappedFile& s21::MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    close();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    is_mapped_ = std::exchange(other.is_mapped_, false);
+    is_open_ = std::exchange(other.is_open_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+s21::MappedFile::~MappedFile() { close(); }
+
+bool s21::MappedFile::open(const std::string& filename) {
+  close();
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  is_open_ = true;
+  if (size_ != 0) {
+    void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      ::madvise(addr, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const char*>(addr);
+      is_mapped_ = true;
+    }
+  }
+  ::close(fd);
+
+  if (!is_mapped_ && size_ != 0) {
+    std::ifstream file(filename, std::ios::binary);
+    buffer_.resize(size_);
+    if (!file.read(buffer_.data(), static_cast<std::streamsize>(size_))) {
+      close();
+      return false;
+    }
+    data_ = buffer_.data();
+  }
+  return true;
+}
+
+void s21::MappedFile::close() {
+  if (is_mapped_) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  is_mapped_ = false;
+  is_open_ = false;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+}
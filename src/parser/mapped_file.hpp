@@ -0,0 +1,95 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_PARSER_MAPPED_FILE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_PARSER_MAPPED_FILE_HPP_
+
+/************************************************************
+ * @file mapped_file.hpp
+ * @brief Отображение файла в память только для чтения
+ ************************************************************/
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Класс, отображающий файл в память (mmap)
+ *
+ * Владеет отображением и освобождает его в деструкторе. Если отобразить
+ *файл не удалось, содержимое читается в собственный буфер, поэтому
+ *вызывающему коду не нужно различать эти случаи.
+ ************************************************************/
+class MappedFile {
+ public:
+  /************************************************************
+   * @brief Конструктор по умолчанию
+   * @details Создает пустое отображение
+   ************************************************************/
+  MappedFile() = default;
+
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param filename Путь до файла, который отображаем в память
+   ************************************************************/
+  explicit MappedFile(const std::string& filename);
+
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  /************************************************************
+   * @brief Деструктор
+   * @details Снимает отображение файла
+   ************************************************************/
+  ~MappedFile();
+
+  /************************************************************
+   * @brief Метод для отображения файла в память
+   * @param filename Путь до файла
+   * @return true, если файл удалось открыть
+   ************************************************************/
+  bool open(const std::string& filename);
+
+  /************************************************************
+   * @brief Метод для снятия отображения
+   * @return void
+   ************************************************************/
+  void close();
+
+  /************************************************************
+   * @brief Проверка, открыт ли файл
+   ************************************************************/
+  bool is_open() const { return is_open_; }
+
+  /************************************************************
+   * @brief Указатель на первый байт файла
+   ************************************************************/
+  const char* data() const { return data_; }
+
+  /************************************************************
+   * @brief Размер файла в байтах
+   ************************************************************/
+  std::size_t size() const { return size_; }
+
+  /************************************************************
+   * @brief Содержимое файла в виде строки без копирования
+   ************************************************************/
+  std::string_view view() const { return {data_, size_}; }
+
+ private:
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+  bool is_mapped_ = false;
+  bool is_open_ = false;
+
+  /************************************************************
+   * @brief Буфер на случай, если mmap недоступен
+   ************************************************************/
+  std::vector<char> buffer_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_PARSER_MAPPED_FILE_HPP_
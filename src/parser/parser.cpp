@@ -1,64 +1,233 @@
 #include "parser.hpp"
 
+#include <algorithm>
+#include <cstring>
+
+#include "../concurrency/thread_pool.hpp"
+#include "mapped_file.hpp"
+#include "tokenizer.hpp"
+
 /************************************************************
  * @file parser.сpp
  * @brief Рализация парсинга через паттерн "Стратегия"
  ************************************************************/
 
-s21::ParsingVertex::ParsingVertex(Object &object) : object{object} {}
+namespace {
 
-void s21::ParsingVertex::parse(const std::string &line) const {
-  std::istringstream iss(line);
-  std::string symbol{};
-  double x, y, z;
-  if (iss >> symbol >> x >> y >> z) {
-    object.vertexes.emplace_back(x, y, z);
-  }
+/************************************************************
+ * @brief Минимальный размер части файла при параллельном разборе
+ ************************************************************/
+constexpr std::size_t kMinChunkSize = 1 << 20;
+
+/************************************************************
+ * @brief Через сколько строк обновляется прогресс и проверяется отмена
+ ************************************************************/
+constexpr std::size_t kProgressBatch = 1 << 14;
+
+bool isCancelled(const s21::ParseProgress *progress) {
+  return progress != nullptr &&
+         progress->cancelled.load(std::memory_order_relaxed);
 }
 
-s21::ParsingLine::ParsingLine(Object &object) : object{object} {}
-
-void s21::ParsingLine::parse(const std::string &line) const {
-  std::stringstream iss(line);
-  std::string symbol{};
-  std::string word{};
-  iss >> symbol;
-  iss.ignore();
-  Line res{};
-  char delim{' '};
-  while (std::getline(iss, word, delim)) {
-    std::stringstream iss2(word);
-    double point{};
-    iss2 >> point;
-    res.indexes.push_back(point);
+void report(s21::ParseContext &context, std::size_t &bytes,
+            std::size_t &records) {
+  if (context.batches != nullptr && *context.batches) {
+    s21::Object &object = context.object;
+    if (!object.vertexes.empty() || !object.lines.empty()) {
+      context.vertex_base += object.vertexes.size();
+      (*context.batches)(object);
+      object.vertexes.clear();
+      object.lines.clear();
+    }
+  }
+  if (context.progress != nullptr) {
+    context.progress->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    context.progress->records.fetch_add(records, std::memory_order_relaxed);
   }
-  object.lines.push_back(res);
+  bytes = 0;
+  records = 0;
+}
+
+}  // namespace
+
+s21::ParsingVertex::ParsingVertex(Object &object) : object{object} {}
+
+void s21::ParsingVertex::parse(std::string_view line) const {
+  ParseContext context{object};
+  Tokenizer tokens(line);
+  tokens.readToken();
+  RecordParser<Directive::kVertex>::parse(context, tokens);
+}
+
+s21::ParsingLine::ParsingLine(Object &object, RelativeIndexes *relative)
+    : object{object}, relative{relative} {}
+
+void s21::ParsingLine::parse(std::string_view line) const {
+  ParseContext context{object, relative};
+  Tokenizer tokens(line);
+  tokens.readToken();
+  RecordParser<Directive::kFace>::parse(context, tokens);
 }
 
 s21::ObjectParser::ObjectParser() {}
 s21::ObjectParser::~ObjectParser() {}
 
-void s21::ObjectParser::set_strategy(
-    std::unique_ptr<s21::ParsingStrategy> &&strategy) {
-  currentStrategy = std::move(strategy);
+s21::Directive s21::ObjectParser::parseLine(ParseContext &context,
+                                           std::string_view line) {
+  Tokenizer tokens(line);
+  Directive directive = classifyDirective(tokens.readToken());
+  dispatchRecord(directive, context, tokens);
+  return directive;
 }
 
-void s21::ObjectParser::parseFile(Object &object, const std::string &filename) {
+void s21::ObjectParser::parseLines(ParseContext &context,
+                                   std::string_view buffer) {
+  const char *it = buffer.data();
+  const char *end = it + buffer.size();
+  const char *reported = it;
+  std::size_t lines = 0, records = 0;
+  while (it != end) {
+    const char *eol = static_cast<const char *>(
+        std::memchr(it, '\n', static_cast<std::size_t>(end - it)));
+    if (eol == nullptr) eol = end;
+    Directive directive = parseLine(
+        context, std::string_view(it, static_cast<std::size_t>(eol - it)));
+    if (directive != Directive::kUnknown) records++;
+    it = eol == end ? end : eol + 1;
+    if (++lines % kProgressBatch == 0) {
+      std::size_t bytes = static_cast<std::size_t>(it - reported);
+      reported = it;
+      report(context, bytes, records);
+      if (isCancelled(context.progress)) return;
+    }
+  }
+  std::size_t bytes = static_cast<std::size_t>(it - reported);
+  report(context, bytes, records);
+}
+
+void s21::ObjectParser::parseFile(Object &object, const std::string &filename,
+                                  ParseMode mode) {
+  if (mode == ParseMode::kMapped) {
+    parseMapped(object, filename);
+  } else if (mode == ParseMode::kParallel) {
+    parseParallel(object, filename);
+  } else {
+    parseStream(object, filename);
+  }
+}
+
+void s21::ObjectParser::parseStream(Object &object,
+                                    const std::string &filename) {
   std::ifstream file;
   file.open(filename);
   if (file.is_open()) {
+    if (progress_ != nullptr) {
+      file.seekg(0, std::ios::end);
+      progress_->total_bytes = static_cast<std::size_t>(file.tellg());
+      file.seekg(0, std::ios::beg);
+    }
+    ParseContext context{object, nullptr, progress_, &batches_, bounds_};
     std::string line;
+    std::size_t lines = 0, bytes = 0, records = 0;
     while (std::getline(file, line)) {
-      if (!line.empty()) {
-        if (line.substr(0, 2) == "v ") {
-          set_strategy(std::make_unique<ParsingVertex>(object));
-          currentStrategy->parse(line);
-        } else if (line.substr(0, 2) == "f ") {
-          set_strategy(std::make_unique<ParsingLine>(object));
-          currentStrategy->parse(line);
-        }
+      if (parseLine(context, line) != Directive::kUnknown) records++;
+      bytes += line.size() + 1;
+      if (++lines % kProgressBatch == 0) {
+        report(context, bytes, records);
+        if (isCancelled(progress_)) break;
       }
     }
+    report(context, bytes, records);
     file.close();
+    validate(object);
   }
 }
+
+void s21::ObjectParser::parseMapped(Object &object,
+                                    const std::string &filename) {
+  MappedFile file(filename);
+  if (file.is_open()) {
+    if (progress_ != nullptr) progress_->total_bytes = file.size();
+    parseBuffer(object, file.view());
+  }
+}
+
+void s21::ObjectParser::parseBuffer(Object &object, std::string_view buffer) {
+  ParseContext context{object, nullptr, progress_, &batches_, bounds_};
+  parseLines(context, buffer);
+  validate(object);
+}
+
+void s21::ObjectParser::parseParallel(Object &object,
+                                      const std::string &filename) {
+  MappedFile file(filename);
+  if (file.is_open()) {
+    if (progress_ != nullptr) progress_->total_bytes = file.size();
+    parseBufferParallel(object, file.view());
+  }
+}
+
+void s21::ObjectParser::parseBufferParallel(Object &object,
+                                            std::string_view buffer,
+                                            std::size_t chunks) {
+  ThreadPool &pool = ThreadPool::shared();
+  if (chunks == 0) {
+    chunks = std::min(pool.size() * 4, buffer.size() / kMinChunkSize);
+  }
+  if (chunks <= 1) {
+    parseBuffer(object, buffer);
+    return;
+  }
+
+  std::vector<std::string_view> parts;
+  parts.reserve(chunks);
+  std::size_t begin = 0;
+  for (std::size_t i = 1; i <= chunks && begin < buffer.size(); i++) {
+    std::size_t end = buffer.size() * i / chunks;
+    if (end < begin) end = begin;
+    end = buffer.find('\n', end);
+    end = end == std::string_view::npos ? buffer.size() : end + 1;
+    parts.push_back(buffer.substr(begin, end - begin));
+    begin = end;
+  }
+
+  std::vector<Object> results(parts.size());
+  std::vector<RelativeIndexes> relative(parts.size());
+  std::vector<Bounds> bounds(bounds_ != nullptr ? parts.size() : 0);
+  pool.parallelFor(parts.size(), [&](std::size_t i) {
+    ParseContext context{results[i], &relative[i], progress_, nullptr,
+                         bounds.empty() ? nullptr : &bounds[i]};
+    parseLines(context, parts[i]);
+  });
+  if (isCancelled(progress_)) return;
+  for (const Bounds &part : bounds) bounds_->extend(part);
+
+  std::size_t vertexes = object.vertexes.size();
+  std::size_t lines = object.lines.size();
+  std::size_t indexes = object.lines.indexCount();
+  for (const Object &part : results) {
+    vertexes += part.vertexes.size();
+    lines += part.lines.size();
+    indexes += part.lines.indexCount();
+  }
+  object.vertexes.reserve(vertexes);
+  object.lines.reserve(lines, indexes);
+  int offset = static_cast<int>(object.vertexes.size());
+  for (std::size_t i = 0; i < results.size(); i++) {
+    Object &part = results[i];
+    int *part_indexes = part.lines.indexes();
+    for (std::size_t position : relative[i]) {
+      part_indexes[position] += offset;
+    }
+    offset += static_cast<int>(part.vertexes.size());
+    object.vertexes.append(part.vertexes);
+    object.lines.append(part.lines);
+  }
+  validate(object);
+}
+
+void s21::ObjectParser::validate(Object &object) {
+  validation_ = FaceValidation{};
+  if (batches_ || isCancelled(progress_)) return;
+  validation_ = object.lines.validate(object.vertexes.size(), invalid_faces_);
+}
@@ -9,11 +9,25 @@
 #include <fstream>
 #include <memory>
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 #include "../object/object.hpp"
+#include "directives.hpp"
 
 namespace s21 {
 
+/************************************************************
+ * @brief Способ чтения obj файла
+ *
+ * kStream - построчное чтение через std::ifstream;
+ * kMapped - файл отображается в память (mmap) и разбирается прямо по
+ *отображенным байтам, без копирования строк;
+ * kParallel - отображенный файл делится на части по границам строк, части
+ *разбираются в пуле потоков и склеиваются в порядке следования в файле
+ ************************************************************/
+enum class ParseMode { kStream, kMapped, kParallel };
+
 /************************************************************
  * Базовый класс для стратегии парсинга obj файла
  * @brief Содержит виртуальный метод парсинга.
@@ -22,10 +36,10 @@ class ParsingStrategy {
  public:
   /************************************************************
    * @brief Виртуальный метод для парсинга вершин
-   * @param line Ссылка на строчку, считанную из obj файла
+   * @param line Строчка из obj файла без символа перевода строки
    * @return void
    ************************************************************/
-  virtual void parse(const std::string& line) const = 0;
+  virtual void parse(std::string_view line) const = 0;
 };
 
 /************************************************************
@@ -47,10 +61,10 @@ class ParsingVertex : public ParsingStrategy {
 
   /************************************************************
    * @brief Переопределенный метод для парсинга вершин
-   * @param line Ссылка на строчку, считанную из obj файла
+   * @param line Строчка из obj файла без символа перевода строки
    * @return void
    ************************************************************/
-  void parse(const std::string& line) const override;
+  void parse(std::string_view line) const override;
 };
 
 /************************************************************
@@ -65,37 +79,111 @@ class ParsingLine : public ParsingStrategy {
    ************************************************************/
   Object& object;
 
+  /************************************************************
+   * @brief Куда записываются позиции относительных индексов
+   * @details Может быть nullptr, если позиции не нужны
+   ************************************************************/
+  RelativeIndexes* relative;
+
   /************************************************************
    * @brief Параметризированный конструскор
    * @param object Ссылка на класс, в котором храним всю информацию о 3д моделе
+   * @param relative Куда записывать позиции относительных индексов
    ************************************************************/
-  ParsingLine(Object& object);
+  ParsingLine(Object& object, RelativeIndexes* relative = nullptr);
 
   /************************************************************
    * @brief Переопределенный метод для парсинга фасетов (полигонов)
-   * @param line Ссылка на строчку, считанную из obj файла
+   *
+   * Из записей v/vt/vn сохраняется индекс вершины. Отрицательные индексы
+   *отсчитываются от последней прочитанной вершины.
+   * @param line Строчка из obj файла без символа перевода строки
    * @return void
    ************************************************************/
-  void parse(const std::string& line) const override;
+  void parse(std::string_view line) const override;
 };
 
 /************************************************************
  * Класс для реализации паттерна "Стратегия"
  * @brief Содержит метод для файла
+ *
+ * Обработчик каждой записи выбирается по таблице из directives.hpp, которая
+ *разрешается на этапе компиляции.
  ************************************************************/
 class ObjectParser {
  private:
   /************************************************************
-   * @brief Умный указатель, который указывает на текущую стратегию парсинга
+   * @brief Метод для разбора одной строки obj файла
+   * @param context Состояние разбора
+   * @param line Строчка без символа перевода строки
+   * @return Запись, которой оказалась строка
+   ************************************************************/
+  static Directive parseLine(ParseContext& context, std::string_view line);
+
+  /************************************************************
+   * @brief Метод для разбора всех строк буфера
+   * @param context Состояние разбора
+   * @param buffer Содержимое файла или его часть
+   * @return void
+   ************************************************************/
+  static void parseLines(ParseContext& context, std::string_view buffer);
+
+  /************************************************************
+   * @brief Куда сообщается прогресс разбора
+   ************************************************************/
+  ParseProgress* progress_ = nullptr;
+
+  /************************************************************
+   * @brief Обработчик пачек записей
+   ************************************************************/
+  BatchHandler batches_;
+
+  /************************************************************
+   * @brief Куда добавляются прочитанные вершины
+   ************************************************************/
+  Bounds* bounds_ = nullptr;
+
+  /************************************************************
+   * @brief Что делать с полигонами с недопустимыми индексами
+   ************************************************************/
+  InvalidFaces invalid_faces_ = InvalidFaces::kRepair;
+
+  /************************************************************
+   * @brief Результат проверки индексов последнего разбора
+   ************************************************************/
+  FaceValidation validation_;
+
+  /************************************************************
+   * @brief Метод для проверки индексов после разбора
+   * @details При разборе пачками проверка остается получателю пачек
+   * @param object Разобранный объект
+   * @return void
+   ************************************************************/
+  void validate(Object& object);
+
+  /************************************************************
+   * @brief Метод для построчного чтения через std::ifstream
+   * @param object Объект в котором будет сохраняться информация о 3д моделе
+   * @param filename Путь до файла, который будем парсить
+   * @return void
+   ************************************************************/
+  void parseStream(Object& object, const std::string& filename);
+
+  /************************************************************
+   * @brief Метод для чтения файла, отображенного в память
+   * @param object Объект в котором будет сохраняться информация о 3д моделе
+   * @param filename Путь до файла, который будем парсить
+   * @return void
    ************************************************************/
-  std::unique_ptr<ParsingStrategy> currentStrategy;
+  void parseMapped(Object& object, const std::string& filename);
 
   /************************************************************
-   * @brief Метод для смены текущей стратегии парсинга
-   * @param strategy Стратегия для парсинга текущей строки
+   * @brief Метод для параллельного чтения файла, отображенного в память
+   * @param object Объект в котором будет сохраняться информация о 3д моделе
+   * @param filename Путь до файла, который будем парсить
    * @return void
    ************************************************************/
-  void set_strategy(std::unique_ptr<ParsingStrategy>&& strategy);
+  void parseParallel(Object& object, const std::string& filename);
 
  public:
   /************************************************************
@@ -108,13 +196,88 @@ class ObjectParser {
    ************************************************************/
   ~ObjectParser();
 
+  /************************************************************
+   * @brief Метод для подключения отслеживания прогресса и отмены
+   *
+   * Пока прогресс подключен, разбор сообщает в него количество
+   *обработанных байт и записей и прекращается, если выставлен флаг отмены.
+   * @param progress Прогресс или nullptr, чтобы отключить отслеживание
+   * @return void
+   ************************************************************/
+  void setProgress(ParseProgress* progress) { progress_ = progress; }
+
+  /************************************************************
+   * @brief Метод для включения разбора пачками
+   *
+   * При последовательном разборе (kStream, kMapped) записи отдаются
+   *обработчику пачками по мере чтения файла, а не накапливаются в объекте
+   *целиком. Индексы полигонов остаются сквозными по всему файлу. Части,
+   *разобранные параллельно (kParallel), пачками не публикуются.
+   * @param handler Обработчик или пустая функция, чтобы выключить
+   * @return void
+   ************************************************************/
+  void setBatchHandler(BatchHandler handler) { batches_ = std::move(handler); }
+
+  /************************************************************
+   * @brief Метод для подсчета параллелепипеда модели во время разбора
+   *
+   * Пока параллелепипед подключен, каждая прочитанная вершина расширяет
+   *его, поэтому для нормализации не нужен отдельный проход по вершинам.
+   *Параллелепипед не очищается перед разбором.
+   * @param bounds Параллелепипед или nullptr, чтобы отключить подсчет
+   * @return void
+   ************************************************************/
+  void setBounds(Bounds* bounds) { bounds_ = bounds; }
+
+  /************************************************************
+   * @brief Метод для выбора обработки недопустимых полигонов
+   *
+   * После разбора индексы всех полигонов проверяются один раз
+   *(FaceArray::validate), так что отрисовка может обращаться к вершинам
+   *без проверок. По умолчанию недопустимые индексы удаляются из полигона.
+   * @param mode Исправлять или удалять такие полигоны
+   * @return void
+   ************************************************************/
+  void setInvalidFaces(InvalidFaces mode) { invalid_faces_ = mode; }
+
+  /************************************************************
+   * @brief Результат проверки индексов последнего разбора
+   ************************************************************/
+  const FaceValidation& validation() const { return validation_; }
+
   /************************************************************
    * @brief Метод для парсинга файла
    * @param object Объект в котором будет сохраняться информация о 3д моделе
    * @param filename Путь до файла, который будем парсить
+   * @param mode Способ чтения файла
+   * @return void
+   ************************************************************/
+  void parseFile(Object& object, const std::string& filename,
+                 ParseMode mode = ParseMode::kMapped);
+
+  /************************************************************
+   * @brief Метод для парсинга содержимого obj файла, уже находящегося в памяти
+   * @param object Объект в котором будет сохраняться информация о 3д моделе
+   * @param buffer Содержимое файла
+   * @return void
+   ************************************************************/
+  void parseBuffer(Object& object, std::string_view buffer);
+
+  /************************************************************
+   * @brief Метод для параллельного парсинга содержимого obj файла
+   *
+   * Буфер делится на части, выровненные по концам строк. Каждая часть
+   *разбирается в отдельный Object, затем вершины и полигоны склеиваются в
+   *порядке следования в файле, поэтому результат совпадает с
+   *последовательным разбором.
+   * @param object Объект в котором будет сохраняться информация о 3д моделе
+   * @param buffer Содержимое файла
+   * @param chunks Количество частей. 0 - выбирается по размеру буфера и
+   *количеству потоков
    * @return void
    ************************************************************/
-  void parseFile(Object& object, const std::string& filename);
+  void parseBufferParallel(Object& object, std::string_view buffer,
+                           std::size_t chunks = 0);
 };
 
 }  // namespace s21
@@ -0,0 +1,74 @@
+#include "tokenizer.hpp"
+
+#include <charconv>
+
+/************************************************************
+ * @file tokenizer.cpp
+ * @brief Разбор чисел в строках obj файла без выделения памяти
+ ************************************************************/
+
+namespace {
+
+bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+}  // namespace
+
+void s21::Tokenizer::skipSpaces() {
+  while (it_ != end_ && isSpace(*it_)) ++it_;
+}
+
+bool s21::Tokenizer::atEnd() {
+  skipSpaces();
+  return it_ == end_ || *it_ == '#';
+}
+
+std::string_view s21::Tokenizer::readToken() {
+  skipSpaces();
+  const char* begin = it_;
+  skipToken();
+  return {begin, static_cast<std::size_t>(it_ - begin)};
+}
+
+void s21::Tokenizer::skipToken() {
+  while (it_ != end_ && !isSpace(*it_)) ++it_;
+}
+
+bool s21::Tokenizer::readDouble(double& value) {
+  skipSpaces();
+  const char* begin = it_;
+  if (begin != end_ && *begin == '+') ++begin;
+  auto [ptr, ec] = std::from_chars(begin, end_, value);
+  if (ec != std::errc()) return false;
+  it_ = ptr;
+  return true;
+}
+
+bool s21::Tokenizer::readIntHere(int& value) {
+  const char* begin = it_;
+  if (begin != end_ && *begin == '+') ++begin;
+  auto [ptr, ec] = std::from_chars(begin, end_, value);
+  if (ec != std::errc()) return false;
+  it_ = ptr;
+  return true;
+}
+
+bool s21::Tokenizer::readInt(int& value) {
+  skipSpaces();
+  return readIntHere(value);
+}
+
+bool s21::Tokenizer::readFaceIndex(FaceIndex& index) {
+  skipSpaces();
+  index = FaceIndex{};
+  bool ok = readIntHere(index.vertex);
+  if (ok && it_ != end_ && *it_ == '/') {
+    ++it_;
+    if (it_ != end_ && *it_ != '/') readIntHere(index.texture);
+    if (it_ != end_ && *it_ == '/') {
+      ++it_;
+      readIntHere(index.normal);
+    }
+  }
+  skipToken();
+  return ok && index.vertex != 0;
+}
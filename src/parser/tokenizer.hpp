@@ -0,0 +1,91 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_PARSER_TOKENIZER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_PARSER_TOKENIZER_HPP_
+
+/************************************************************
+ * @file tokenizer.hpp
+ * @brief Разбор чисел в строках obj файла без выделения памяти
+ ************************************************************/
+
+#include <string_view>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Индексы одной вершины полигона: v, v/vt, v//vn или v/vt/vn
+ * @details Отсутствующий индекс равен 0
+ ************************************************************/
+struct FaceIndex {
+  int vertex = 0;
+  int texture = 0;
+  int normal = 0;
+};
+
+/************************************************************
+ * @brief Класс для разбора одной строки obj файла
+ *
+ * Работает прямо по байтам строки и не выделяет память: числа читаются
+ *через std::from_chars, разделителями считаются пробел, табуляция и '\r'.
+ ************************************************************/
+class Tokenizer {
+ public:
+  /************************************************************
+   * @brief Параметризированный конструктор
+   * @param line Строчка из obj файла
+   ************************************************************/
+  explicit Tokenizer(std::string_view line)
+      : it_{line.data()}, end_{line.data() + line.size()} {}
+
+  /************************************************************
+   * @brief Проверка, остались ли в строке токены
+   * @details Пропускает разделители перед следующим токеном. Комментарий
+   *от '#' до конца строки токенов не содержит
+   ************************************************************/
+  bool atEnd();
+
+  /************************************************************
+   * @brief Метод для чтения очередного токена как строки
+   * @return Токен или пустая строка, если токенов не осталось
+   ************************************************************/
+  std::string_view readToken();
+
+  /************************************************************
+   * @brief Метод для пропуска остатка текущего токена
+   * @return void
+   ************************************************************/
+  void skipToken();
+
+  /************************************************************
+   * @brief Метод для чтения вещественного числа
+   * @param value Прочитанное значение
+   * @return true, если число прочитано
+   ************************************************************/
+  bool readDouble(double& value);
+
+  /************************************************************
+   * @brief Метод для чтения целого числа
+   * @param value Прочитанное значение
+   * @return true, если число прочитано
+   ************************************************************/
+  bool readInt(int& value);
+
+  /************************************************************
+   * @brief Метод для чтения индексов вершины полигона
+   *
+   * Понимает записи v, v/vt, v//vn и v/vt/vn, в том числе отрицательные
+   *(относительные) индексы. Токен читается до конца.
+   * @param index Прочитанные индексы
+   * @return true, если прочитан ненулевой индекс вершины
+   ************************************************************/
+  bool readFaceIndex(FaceIndex& index);
+
+ private:
+  void skipSpaces();
+  bool readIntHere(int& value);
+
+  const char* it_;
+  const char* end_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_PARSER_TOKENIZER_HPP_
@@ -0,0 +1,184 @@
+#include "gif_writer.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <gif_lib.h>
+
+/************************************************************
+ * @file gif_writer.cpp
+ * @brief Покадровая запись анимации GIF
+ ************************************************************/
+
+namespace {
+
+/************************************************************
+ * @brief Наибольшее число цветов в палитре GIF
+ ************************************************************/
+constexpr int kMaxColors = 256;
+
+int writeToStream(GifFileType* gif, const GifByteType* data, int size) {
+  auto* file = static_cast<std::ofstream*>(gif->UserData);
+  file->write(reinterpret_cast<const char*>(data), size);
+  return *file ? size : 0;
+}
+
+/************************************************************
+ * @brief Размер палитры GIF: степень двойки от 2 до 256
+ ************************************************************/
+int paletteSize(int colors) {
+  int size = 2;
+  while (size < colors) size <<= 1;
+  return size;
+}
+
+}  // namespace
+
+s21::GifWriter::~GifWriter() { close(); }
+
+bool s21::GifWriter::open(const std::string& filename, int width, int height,
+                          int delay_ms) {
+  close();
+  if (width <= 0 || height <= 0 || width > 0xFFFF || height > 0xFFFF) {
+    return false;
+  }
+  file_.open(filename, std::ios::binary | std::ios::trunc);
+  if (!file_) return false;
+  int error = 0;
+  gif_ = EGifOpen(&file_, writeToStream, &error);
+  if (gif_ == nullptr) {
+    file_.close();
+    return false;
+  }
+  width_ = width;
+  height_ = height;
+  delay_ = (std::max(delay_ms, 0) + 5) / 10;
+  frames_ = 0;
+
+  // Задержка кадров и повтор есть только в GIF89a, а последовательный API
+  // не знает заранее, что они будут записаны
+  EGifSetGifVersion(gif_, true);
+  if (EGifPutScreenDesc(gif_, width, height, 8, 0, nullptr) == GIF_ERROR ||
+      !writeLoopExtension()) {
+    return fail();
+  }
+  file_.flush();
+  return static_cast<bool>(file_) || fail();
+}
+
+bool s21::GifWriter::addFrame(const Image& image) {
+  if (gif_ == nullptr || image.width() != width_ ||
+      image.height() != height_) {
+    return false;
+  }
+  if (!buildPalette(image) && !quantize(image)) return fail();
+
+  int colors = static_cast<int>(palette_.size() / 3);
+  ColorMapObject* map = GifMakeMapObject(paletteSize(colors), nullptr);
+  if (map == nullptr) return fail();
+  for (int i = 0; i < colors; i++) {
+    map->Colors[i] = GifColorType{palette_[i * 3], palette_[i * 3 + 1],
+                                  palette_[i * 3 + 2]};
+  }
+
+  GraphicsControlBlock control{DISPOSE_DO_NOT, false, delay_,
+                               NO_TRANSPARENT_COLOR};
+  GifByteType extension[4];
+  int length = static_cast<int>(EGifGCBToExtension(&control, extension));
+  // EGifPutImageDesc копирует палитру кадра, не освобождая палитру
+  // предыдущего, поэтому она освобождается здесь
+  GifFreeMapObject(gif_->Image.ColorMap);
+  gif_->Image.ColorMap = nullptr;
+  bool written =
+      EGifPutExtension(gif_, GRAPHICS_EXT_FUNC_CODE, length, extension) !=
+          GIF_ERROR &&
+      EGifPutImageDesc(gif_, 0, 0, width_, height_, false, map) != GIF_ERROR;
+  GifFreeMapObject(map);
+  for (int y = 0; written && y < height_; y++) {
+    written = EGifPutLine(gif_, &indexes_[static_cast<std::size_t>(y) * width_],
+                          width_) != GIF_ERROR;
+  }
+  file_.flush();
+  if (!written || !file_) return fail();
+  frames_++;
+  return true;
+}
+
+bool s21::GifWriter::close() {
+  if (gif_ == nullptr) return false;
+  bool closed = EGifCloseFile(gif_) != GIF_ERROR;
+  gif_ = nullptr;
+  file_.close();
+  return closed && !file_.fail();
+}
+
+bool s21::GifWriter::buildPalette(const Image& image) {
+  std::size_t pixels = static_cast<std::size_t>(width_) * height_;
+  indexes_.resize(pixels);
+  palette_.clear();
+  std::unordered_map<std::uint32_t, std::uint8_t> colors;
+  // Соседние пиксели каркаса чаще всего одного цвета, поэтому поиск в
+  // таблице нужен только при смене цвета
+  std::uint32_t last = UINT32_MAX;
+  std::uint8_t last_index = 0;
+  const std::uint8_t* p = image.data();
+  for (std::size_t i = 0; i < pixels; i++, p += 4) {
+    std::uint32_t rgb = static_cast<std::uint32_t>(p[0]) << 16 | p[1] << 8 |
+                        p[2];
+    if (rgb != last) {
+      auto found = colors.find(rgb);
+      if (found == colors.end()) {
+        if (colors.size() == kMaxColors) return false;
+        auto index = static_cast<std::uint8_t>(colors.size());
+        found = colors.emplace(rgb, index).first;
+        palette_.insert(palette_.end(), {p[0], p[1], p[2]});
+      }
+      last = rgb;
+      last_index = found->second;
+    }
+    indexes_[i] = last_index;
+  }
+  return true;
+}
+
+bool s21::GifWriter::quantize(const Image& image) {
+  std::size_t pixels = static_cast<std::size_t>(width_) * height_;
+  planes_.resize(pixels * 3);
+  std::uint8_t* red = planes_.data();
+  std::uint8_t* green = red + pixels;
+  std::uint8_t* blue = green + pixels;
+  const std::uint8_t* p = image.data();
+  for (std::size_t i = 0; i < pixels; i++, p += 4) {
+    red[i] = p[0];
+    green[i] = p[1];
+    blue[i] = p[2];
+  }
+  int count = kMaxColors;
+  GifColorType colors[kMaxColors];
+  if (GifQuantizeBuffer(width_, height_, &count, red, green, blue,
+                        indexes_.data(), colors) == GIF_ERROR) {
+    return false;
+  }
+  palette_.clear();
+  for (int i = 0; i < count; i++) {
+    palette_.insert(palette_.end(),
+                    {colors[i].Red, colors[i].Green, colors[i].Blue});
+  }
+  return true;
+}
+
+bool s21::GifWriter::writeLoopExtension() {
+  // Блок приложения NETSCAPE2.0: подблок 1, число повторов 0 - бесконечно
+  const char application[] = "NETSCAPE2.0";
+  const GifByteType loop[] = {1, 0, 0};
+  return EGifPutExtensionLeader(gif_, APPLICATION_EXT_FUNC_CODE) !=
+             GIF_ERROR &&
+         EGifPutExtensionBlock(gif_, 11, application) != GIF_ERROR &&
+         EGifPutExtensionBlock(gif_, 3, loop) != GIF_ERROR &&
+         EGifPutExtensionTrailer(gif_) != GIF_ERROR;
+}
+
+bool s21::GifWriter::fail() {
+  close();
+  return false;
+}
@@ -0,0 +1,92 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_RENDER_GIF_WRITER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_RENDER_GIF_WRITER_HPP_
+
+/************************************************************
+ * @file gif_writer.hpp
+ * @brief Покадровая запись анимации GIF
+ ************************************************************/
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "image.hpp"
+
+struct GifFileType;
+
+namespace s21 {
+
+/************************************************************
+ * @brief Класс для записи анимации GIF по одному кадру
+ *
+ * Работает поверх последовательного API giflib (EGifPut*) из QtGifImage:
+ *каждый кадр сразу получает свою палитру, сжимается и записывается в
+ *файл, после чего в памяти остаются только буферы одного кадра. Поэтому
+ *память не растет с длиной записи, а закрытие файла дописывает только
+ *завершающий байт, в отличие от QGifImage::save, который собирает всю
+ *анимацию в памяти и отдает ее EGifSpew.
+ *
+ * Если в кадре не больше 256 цветов, палитра строится точно, иначе цвета
+ *сокращаются медианным сечением GifQuantizeBuffer. Анимация повторяется
+ *бесконечно (блок NETSCAPE2.0).
+ ************************************************************/
+class GifWriter {
+ public:
+  GifWriter() = default;
+  GifWriter(const GifWriter&) = delete;
+  GifWriter& operator=(const GifWriter&) = delete;
+  ~GifWriter();
+
+  /************************************************************
+   * @brief Метод для создания файла
+   *
+   * Заголовок и размер холста записываются сразу.
+   * @param filename Путь до файла
+   * @param width Ширина кадров в пикселях
+   * @param height Высота кадров в пикселях
+   * @param delay_ms Длительность кадра, хранится в сотых долях секунды
+   * @return true, если файл создан
+   ************************************************************/
+  bool open(const std::string& filename, int width, int height,
+            int delay_ms);
+
+  /************************************************************
+   * @brief Метод для записи кадра в конец анимации
+   *
+   * Кадр сжимается и сбрасывается в файл до возврата из метода.
+   * @param image Кадр размером, заданным в open
+   * @return false, если файл не открыт, размер кадра другой или запись
+   *не удалась; после ошибки записи файл закрывается
+   ************************************************************/
+  bool addFrame(const Image& image);
+
+  /************************************************************
+   * @brief Метод для завершения файла
+   * @return true, если файл записан полностью
+   ************************************************************/
+  bool close();
+
+  bool isOpen() const { return gif_ != nullptr; }
+  int frameCount() const { return frames_; }
+
+ private:
+  bool buildPalette(const Image& image);
+  bool quantize(const Image& image);
+  bool writeLoopExtension();
+  bool fail();
+
+  std::ofstream file_;
+  GifFileType* gif_ = nullptr;
+  int width_ = 0;
+  int height_ = 0;
+  int delay_ = 0;  // В сотых долях секунды
+  int frames_ = 0;
+  std::vector<std::uint8_t> indexes_;  // Номера цветов пикселей кадра
+  std::vector<std::uint8_t> palette_;  // RGB, по 3 байта на цвет
+  std::vector<std::uint8_t> planes_;   // Каналы R, G, B для квантования
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_RENDER_GIF_WRITER_HPP_
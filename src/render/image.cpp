@@ -0,0 +1,42 @@
+#include "image.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/************************************************************
+ * @file image.cpp
+ * @brief Изображение RGBA в памяти
+ ************************************************************/
+
+namespace {
+
+std::uint32_t channel(float value) {
+  return static_cast<std::uint32_t>(
+      std::lround(std::clamp(value, 0.f, 1.f) * 255));
+}
+
+}  // namespace
+
+s21::Image::Image(int width, int height)
+    : width_{std::max(width, 0)},
+      height_{std::max(height, 0)},
+      pixels_(static_cast<std::size_t>(width_) * height_ * 4, 0) {}
+
+void s21::Image::fill(Color color) {
+  std::uint32_t value = pack(color);
+  for (int y = 0; y < height_; y++) {
+    for (int x = 0; x < width_; x++) set(x, y, value);
+  }
+}
+
+std::uint32_t s21::Image::rgba(int x, int y) const {
+  const std::uint8_t* p = pixel(x, y);
+  return static_cast<std::uint32_t>(p[0]) << 24 |
+         static_cast<std::uint32_t>(p[1]) << 16 |
+         static_cast<std::uint32_t>(p[2]) << 8 | p[3];
+}
+
+std::uint32_t s21::Image::pack(Color color) {
+  return channel(color.red) << 24 | channel(color.green) << 16 |
+         channel(color.blue) << 8 | 0xFFu;
+}
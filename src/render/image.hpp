@@ -0,0 +1,95 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_RENDER_IMAGE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_RENDER_IMAGE_HPP_
+
+/************************************************************
+ * @file image.hpp
+ * @brief Изображение RGBA в памяти
+ ************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Цвет, компоненты от 0 до 1
+ ************************************************************/
+struct Color {
+  float red, green, blue;
+};
+
+/************************************************************
+ * @brief Класс изображения RGBA, по 8 бит на компоненту
+ *
+ * Строки идут сверху вниз без выравнивания, поэтому данные можно сразу
+ *обернуть в QImage::Format_RGBA8888 или передать в PNG.
+ ************************************************************/
+class Image {
+ public:
+  Image() = default;
+
+  /************************************************************
+   * @brief Конструктор
+   * @details Изображение заполняется прозрачным черным
+   ************************************************************/
+  Image(int width, int height);
+
+  int width() const { return width_; }
+  int height() const { return height_; }
+  bool empty() const { return pixels_.empty(); }
+
+  /************************************************************
+   * @brief Метод для заливки всего изображения непрозрачным цветом
+   * @return void
+   ************************************************************/
+  void fill(Color color);
+
+  /************************************************************
+   * @brief Метод для записи непрозрачного пикселя
+   * @details Координаты должны лежать внутри изображения
+   * @return void
+   ************************************************************/
+  void set(int x, int y, std::uint32_t rgba) {
+    std::uint8_t* p = pixel(x, y);
+    p[0] = static_cast<std::uint8_t>(rgba >> 24);
+    p[1] = static_cast<std::uint8_t>(rgba >> 16);
+    p[2] = static_cast<std::uint8_t>(rgba >> 8);
+    p[3] = static_cast<std::uint8_t>(rgba);
+  }
+
+  /************************************************************
+   * @brief Компоненты R, G, B, A пикселя
+   ************************************************************/
+  std::uint8_t* pixel(int x, int y) {
+    return pixels_.data() + (static_cast<std::size_t>(y) * width_ + x) * 4;
+  }
+  const std::uint8_t* pixel(int x, int y) const {
+    return pixels_.data() + (static_cast<std::size_t>(y) * width_ + x) * 4;
+  }
+
+  /************************************************************
+   * @brief Пиксель в виде 0xRRGGBBAA
+   ************************************************************/
+  std::uint32_t rgba(int x, int y) const;
+
+  /************************************************************
+   * @brief Все пиксели подряд, строка за строкой
+   ************************************************************/
+  const std::uint8_t* data() const { return pixels_.data(); }
+  std::uint8_t* data() { return pixels_.data(); }
+
+  /************************************************************
+   * @brief Упаковка цвета в 0xRRGGBBAA с непрозрачной альфой
+   ************************************************************/
+  static std::uint32_t pack(Color color);
+
+ private:
+  int width_ = 0;
+  int height_ = 0;
+  std::vector<std::uint8_t> pixels_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_RENDER_IMAGE_HPP_
@@ -0,0 +1,132 @@
+#include "png_writer.hpp"
+
+#include <zlib.h>
+
+#include <fstream>
+#include <sstream>
+
+/************************************************************
+ * @file png_writer.cpp
+ * @brief Запись изображения в PNG
+ ************************************************************/
+
+namespace {
+
+/************************************************************
+ * @brief Наибольший размер данных фрагмента IDAT
+ ************************************************************/
+constexpr std::size_t kIdatSize = 64 * 1024;
+
+void putBigEndian(std::ostream& out, std::uint32_t value) {
+  const char bytes[] = {
+      static_cast<char>(value >> 24), static_cast<char>(value >> 16),
+      static_cast<char>(value >> 8), static_cast<char>(value)};
+  out.write(bytes, sizeof(bytes));
+}
+
+void putChunk(std::ostream& out, const char* type, const std::uint8_t* data,
+              std::size_t size) {
+  putBigEndian(out, static_cast<std::uint32_t>(size));
+  out.write(type, 4);
+  out.write(reinterpret_cast<const char*>(data),
+            static_cast<std::streamsize>(size));
+  uLong crc = crc32(0, reinterpret_cast<const Bytef*>(type), 4);
+  // crc32 с нулевым указателем возвращает начальное значение
+  if (size > 0) crc = crc32(crc, data, static_cast<uInt>(size));
+  putBigEndian(out, static_cast<std::uint32_t>(crc));
+}
+
+/************************************************************
+ * @brief Поток zlib, разбитый на фрагменты IDAT
+ *
+ * Строки изображения с байтом фильтра 0 перед каждой сжимаются по
+ *частям, а заполненный буфер сразу записывается фрагментом.
+ ************************************************************/
+class IdatStream {
+ public:
+  explicit IdatStream(std::ostream& out) : out_{out}, buffer_(kIdatSize) {
+    ok_ = deflateInit(&stream_, Z_DEFAULT_COMPRESSION) == Z_OK;
+    stream_.next_out = buffer_.data();
+    stream_.avail_out = static_cast<uInt>(buffer_.size());
+  }
+
+  IdatStream(const IdatStream& other) = delete;
+  IdatStream& operator=(const IdatStream& other) = delete;
+
+  ~IdatStream() { deflateEnd(&stream_); }
+
+  bool write(const std::uint8_t* data, std::size_t size) {
+    stream_.next_in = const_cast<Bytef*>(data);
+    stream_.avail_in = static_cast<uInt>(size);
+    while (ok_ && stream_.avail_in > 0) {
+      ok_ = deflate(&stream_, Z_NO_FLUSH) == Z_OK;
+      if (stream_.avail_out == 0) flush();
+    }
+    return ok_;
+  }
+
+  bool finish() {
+    int status = Z_OK;
+    while (ok_ && status == Z_OK) {
+      status = deflate(&stream_, Z_FINISH);
+      ok_ = status == Z_OK || status == Z_STREAM_END;
+      if (stream_.avail_out == 0 || status == Z_STREAM_END) flush();
+    }
+    return ok_;
+  }
+
+ private:
+  void flush() {
+    std::size_t size = buffer_.size() - stream_.avail_out;
+    if (size > 0) putChunk(out_, "IDAT", buffer_.data(), size);
+    stream_.next_out = buffer_.data();
+    stream_.avail_out = static_cast<uInt>(buffer_.size());
+  }
+
+  std::ostream& out_;
+  z_stream stream_{};
+  std::vector<std::uint8_t> buffer_;
+  bool ok_ = false;
+};
+
+}  // namespace
+
+bool s21::writePng(const Image& image, std::ostream& out) {
+  if (image.empty()) return false;
+  const char signature[] = {'\x89', 'P', 'N', 'G', '\r', '\n', '\x1A', '\n'};
+  out.write(signature, sizeof(signature));
+
+  std::ostringstream header;
+  putBigEndian(header, static_cast<std::uint32_t>(image.width()));
+  putBigEndian(header, static_cast<std::uint32_t>(image.height()));
+  // Глубина 8, тип цвета 6 (RGBA), deflate, фильтры по умолчанию, без
+  // чересстрочности
+  header.write("\x08\x06\x00\x00\x00", 5);
+  std::string ihdr = header.str();
+  putChunk(out, "IHDR", reinterpret_cast<const std::uint8_t*>(ihdr.data()),
+           ihdr.size());
+
+  IdatStream idat(out);
+  std::size_t row = static_cast<std::size_t>(image.width()) * 4;
+  const std::uint8_t filter = 0;
+  bool ok = true;
+  for (int y = 0; ok && y < image.height(); y++) {
+    ok = idat.write(&filter, 1) && idat.write(image.pixel(0, y), row);
+  }
+  if (!ok || !idat.finish()) return false;
+  putChunk(out, "IEND", nullptr, 0);
+  return static_cast<bool>(out);
+}
+
+std::vector<std::uint8_t> s21::encodePng(const Image& image) {
+  std::ostringstream out(std::ios::binary);
+  if (!writePng(image, out)) return {};
+  std::string png = out.str();
+  return std::vector<std::uint8_t>(png.begin(), png.end());
+}
+
+bool s21::writePng(const Image& image, const std::string& filename) {
+  if (image.empty()) return false;
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  return file.is_open() && writePng(image, file);
+}
@@ -0,0 +1,48 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_RENDER_PNG_WRITER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_RENDER_PNG_WRITER_HPP_
+
+/************************************************************
+ * @file png_writer.hpp
+ * @brief Запись изображения в PNG
+ ************************************************************/
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "image.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Функция для записи изображения в поток в формате PNG
+ *
+ * Пиксели записываются как RGBA 8 бит без фильтров и сжимаются zlib по
+ *строкам. Сжатые данные выводятся фрагментами IDAT не больше 64 КиБ по
+ *мере заполнения буфера, поэтому файл целиком в памяти не собирается, а
+ *размер фрагмента не упирается в предел PNG 2^31 - 1 байт.
+ * @param image Изображение
+ * @param out Поток, открытый в двоичном режиме
+ * @return false для пустого изображения или при ошибке zlib и записи
+ ************************************************************/
+bool writePng(const Image& image, std::ostream& out);
+
+/************************************************************
+ * @brief Функция для кодирования изображения в PNG в памяти
+ * @param image Изображение
+ * @return Содержимое PNG файла, пустое для пустого изображения
+ ************************************************************/
+std::vector<std::uint8_t> encodePng(const Image& image);
+
+/************************************************************
+ * @brief Функция для записи изображения в PNG файл
+ * @param image Изображение
+ * @param filename Путь до файла
+ * @return true, если файл записан
+ ************************************************************/
+bool writePng(const Image& image, const std::string& filename);
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_RENDER_PNG_WRITER_HPP_
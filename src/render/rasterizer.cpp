@@ -0,0 +1,414 @@
+#include "rasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "../concurrency/thread_pool.hpp"
+#include "../transformation/kernels.hpp"
+
+/************************************************************
+ * @file rasterizer.cpp
+ * @brief Программная отрисовка каркаса модели без OpenGL
+ ************************************************************/
+
+namespace {
+
+/************************************************************
+ * @brief Длина штриха и пропуска пунктира в пикселях, как в шейдере окна
+ ************************************************************/
+constexpr double kDashLength = 8;
+
+/************************************************************
+ * @brief Наименьшее число вершин или ребер в одной параллельной части
+ ************************************************************/
+constexpr std::size_t kMinChunkItems = 1 << 14;
+
+/************************************************************
+ * @brief Номер первого пикселя, центр которого не меньше lo
+ * @details Центры пикселей из [lo, hi) - это номера от firstCenter(lo)
+ *до firstCenter(hi), не включая его
+ ************************************************************/
+int firstCenter(double lo) { return static_cast<int>(std::ceil(lo - 0.5)); }
+
+int lineWidth(const s21::RenderStyle& style) {
+  return std::max(1, static_cast<int>(std::lround(style.line_width)));
+}
+
+std::size_t chunkCount(std::size_t count) {
+  std::size_t threads = s21::ThreadPool::shared().size();
+  return std::clamp<std::size_t>(count / kMinChunkItems, 1,
+                                 std::max<std::size_t>(threads * 4, 1));
+}
+
+/************************************************************
+ * @brief Вызывает body(first, last) для частей [0, count) параллельно
+ ************************************************************/
+void forEachChunk(std::size_t count,
+                  const std::function<void(std::size_t, std::size_t)>& body) {
+  std::size_t chunks = chunkCount(count);
+  s21::ThreadPool::shared().parallelFor(chunks, [&](std::size_t chunk) {
+    body(count * chunk / chunks, count * (chunk + 1) / chunks);
+  });
+}
+
+}  // namespace
+
+s21::Matrix4 s21::projectionMatrix(bool parallel) {
+  if (parallel) return Matrix4::orthographic(-1, 1, -1, 1, -1, 1);
+  return Matrix4::frustum(-0.5, 0.5, -0.5, 0.5, 0.1, 100) *
+         Matrix4::fromMovement(MoveZ, -1.04);
+}
+
+s21::Rasterizer::Rasterizer(int tile_size)
+    : tile_size_(std::max(tile_size, 1)) {}
+
+void s21::Rasterizer::render(const Object& object, const Matrix4& model,
+                             const RenderStyle& style, Image& image) {
+  if (image.empty()) return;
+  width_ = image.width();
+  height_ = image.height();
+  tiles_x_ = (width_ + tile_size_ - 1) / tile_size_;
+  tiles_y_ = (height_ + tile_size_ - 1) / tile_size_;
+  project(object.vertexes, projectionMatrix(style.parallel_projection) * model);
+
+  points_.clear();
+  if (style.vertex_marker != VertexMarker::kNone && style.vertex_size > 0) {
+    setupPoints();
+  }
+  const EdgeTable* edges = &object.edges;
+  if (edges->empty() && !object.lines.empty()) {
+    fallback_edges_.build(object.lines, object.vertexes.size());
+    edges = &fallback_edges_;
+  }
+  setupEdges(*edges);
+
+  float size = style.vertex_size;
+  bin(
+      points_.size(),
+      [this, size](std::size_t i, auto visit) {
+        pointTiles(points_[i], size, visit);
+      },
+      point_bins_);
+  int width = lineWidth(style);
+  bin(
+      edges_.size(),
+      [this, width](std::size_t i, auto visit) {
+        edgeTiles(edges_[i], width, visit);
+      },
+      edge_bins_);
+
+  std::size_t tiles = static_cast<std::size_t>(tiles_x_) * tiles_y_;
+  ThreadPool::shared().parallelFor(tiles, [&](std::size_t index) {
+    rasterizeTile(index, style, image);
+  });
+}
+
+void s21::Rasterizer::project(const VertexArray& vertexes,
+                              const Matrix4& m) {
+  std::size_t count = vertexes.size();
+  for (std::vector<Scalar>& row : clip_) row.resize(count);
+  Scalar matrix[16];
+  for (int col = 0; col < 4; col++) {
+    for (int row = 0; row < 4; row++) {
+      matrix[col * 4 + row] = static_cast<Scalar>(m(row, col));
+    }
+  }
+  const TransformKernels& kernels = transformKernels();
+  forEachChunk(count, [&](std::size_t first, std::size_t last) {
+    Scalar* const rows[4] = {clip_[0].data() + first, clip_[1].data() + first,
+                             clip_[2].data() + first, clip_[3].data() + first};
+    kernels.project(vertexes.x() + first, vertexes.y() + first,
+                    vertexes.z() + first, last - first, matrix, rows);
+  });
+}
+
+void s21::Rasterizer::setupPoints() {
+  points_.resize(clip_[0].size());
+  forEachChunk(points_.size(), [this](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      double x = clip_[0][i], y = clip_[1][i], z = clip_[2][i];
+      double w = clip_[3][i];
+      // Точка целиком отбрасывается, если ее вершина вне пирамиды видимости
+      if (!(w > 0) || std::abs(x) > w || std::abs(y) > w || std::abs(z) > w) {
+        points_[i].visible = false;
+        continue;
+      }
+      // Строки изображения идут сверху вниз, а ось y в OpenGL - снизу вверх
+      points_[i] = ScreenPoint{static_cast<float>((x / w + 1) * 0.5 * width_),
+                               static_cast<float>((1 - y / w) * 0.5 * height_),
+                               static_cast<float>((z / w + 1) * 0.5), true};
+    }
+  });
+}
+
+void s21::Rasterizer::setupEdges(const EdgeTable& edges) {
+  struct Clip {
+    double x, y, z, w;
+  };
+  std::size_t vertex_count = clip_[0].size();
+  auto clipPoint = [this](std::size_t i) {
+    return Clip{clip_[0][i], clip_[1][i], clip_[2][i], clip_[3][i]};
+  };
+  auto screenX = [this](const Clip& p) {
+    return (p.x / p.w + 1) * 0.5 * width_;
+  };
+  auto screenY = [this](const Clip& p) {
+    return (1 - p.y / p.w) * 0.5 * height_;
+  };
+
+  edges_.resize(edges.size());
+  forEachChunk(edges_.size(), [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      ScreenEdge& out = edges_[i];
+      out.visible = false;
+      const Edge& edge = edges[i];
+      if (edge.a >= vertex_count || edge.b >= vertex_count) continue;
+      Clip a = clipPoint(edge.a), b = clipPoint(edge.b);
+
+      // Отсечение Лианга-Барски по шести плоскостям в однородных координатах
+      const double da[6] = {a.w + a.x, a.w - a.x, a.w + a.y,
+                            a.w - a.y, a.w + a.z, a.w - a.z};
+      const double db[6] = {b.w + b.x, b.w - b.x, b.w + b.y,
+                            b.w - b.y, b.w + b.z, b.w - b.z};
+      double t0 = 0, t1 = 1;
+      bool outside = false;
+      for (int k = 0; k < 6 && !outside; k++) {
+        outside = da[k] < 0 && db[k] < 0;
+        if (da[k] < 0) t0 = std::max(t0, da[k] / (da[k] - db[k]));
+        if (db[k] < 0) t1 = std::min(t1, da[k] / (da[k] - db[k]));
+      }
+      if (outside || t0 > t1) continue;
+      auto lerp = [&a, &b](double t) {
+        return Clip{a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t,
+                    a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t};
+      };
+      Clip p0 = lerp(t0), p1 = lerp(t1);
+      out = ScreenEdge{static_cast<float>(screenX(p0)),
+                       static_cast<float>(screenY(p0)),
+                       static_cast<float>((p0.z / p0.w + 1) * 0.5),
+                       static_cast<float>(screenX(p1)),
+                       static_cast<float>(screenY(p1)),
+                       static_cast<float>((p1.z / p1.w + 1) * 0.5),
+                       0,
+                       0,
+                       true};
+      // Пунктир отсчитывается от второй вершины ребра, как от определяющей
+      // вершины отрезка GL_LINES в шейдере
+      bool anchored = b.w > 0;
+      out.anchor_x = anchored ? static_cast<float>(screenX(b)) : out.x1;
+      out.anchor_y = anchored ? static_cast<float>(screenY(b)) : out.y1;
+      out.visible = std::isfinite(out.x0) && std::isfinite(out.y0) &&
+                    std::isfinite(out.x1) && std::isfinite(out.y1);
+    }
+  });
+}
+
+template <typename Visit>
+void s21::Rasterizer::pointTiles(const ScreenPoint& p, float size,
+                                 Visit visit) const {
+  if (!p.visible) return;
+  double half = size / 2.0;
+  int x0 = std::max(firstCenter(p.x - half), 0);
+  int x1 = std::min(firstCenter(p.x + half), width_);
+  int y0 = std::max(firstCenter(p.y - half), 0);
+  int y1 = std::min(firstCenter(p.y + half), height_);
+  if (x0 >= x1 || y0 >= y1) return;
+  for (int ty = y0 / tile_size_; ty <= (y1 - 1) / tile_size_; ty++) {
+    for (int tx = x0 / tile_size_; tx <= (x1 - 1) / tile_size_; tx++) {
+      visit(static_cast<std::size_t>(ty) * tiles_x_ + tx);
+    }
+  }
+}
+
+template <typename Visit>
+void s21::Rasterizer::edgeTiles(const ScreenEdge& e, int width,
+                                Visit visit) const {
+  if (!e.visible) return;
+  double dx = e.x1 - e.x0, dy = e.y1 - e.y0;
+  bool x_major = std::abs(dx) >= std::abs(dy);
+  double major0 = x_major ? e.x0 : e.y0, major1 = x_major ? e.x1 : e.y1;
+  double minor0 = x_major ? e.y0 : e.x0;
+  double span = major1 - major0;
+  if (span == 0) return;
+  double slope = (x_major ? dy : dx) / span;
+  int major_tiles = x_major ? tiles_x_ : tiles_y_;
+  int minor_tiles = x_major ? tiles_y_ : tiles_x_;
+
+  double lo = std::max(std::min(major0, major1), 0.0);
+  double hi = std::min(std::max(major0, major1),
+                       static_cast<double>(x_major ? width_ : height_));
+  if (!(lo < hi)) return;
+  // Столбец пикселей шага лежит в [minor - pad, minor + pad] с запасом на
+  // округление floor и на погрешность шагового вычисления
+  double pad = (width - 1) * 0.5 + 2;
+  double size = tile_size_;
+  int last = std::min(static_cast<int>(hi / size), major_tiles - 1);
+  for (int t = static_cast<int>(lo / size); t <= last; t++) {
+    double a = std::max(lo, t * size), b = std::min(hi, (t + 1) * size);
+    double ma = minor0 + slope * (a - major0);
+    double mb = minor0 + slope * (b - major0);
+    double from = std::floor((std::min(ma, mb) - pad) / size);
+    double to = std::floor((std::max(ma, mb) + pad) / size);
+    int r0 = static_cast<int>(std::max(from, 0.0));
+    int r1 = static_cast<int>(std::min(to, minor_tiles - 1.0));
+    for (int r = r0; r <= r1; r++) {
+      visit(x_major ? static_cast<std::size_t>(r) * tiles_x_ + t
+                    : static_cast<std::size_t>(t) * tiles_x_ + r);
+    }
+  }
+}
+
+template <typename ForEachTile>
+void s21::Rasterizer::bin(std::size_t count, ForEachTile for_each_tile,
+                          Bins& bins) const {
+  std::size_t tiles = static_cast<std::size_t>(tiles_x_) * tiles_y_;
+  std::size_t chunks = chunkCount(count);
+  ThreadPool& pool = ThreadPool::shared();
+
+  // Сортировка подсчетом: сначала каждая часть считает свои элементы в
+  // каждой плитке, затем позиции раздаются по плиткам, а внутри плитки -
+  // по частям, поэтому номера в каждой плитке идут в исходном порядке
+  std::vector<std::size_t> cursors(chunks * tiles, 0);
+  pool.parallelFor(chunks, [&](std::size_t chunk) {
+    std::size_t* row = &cursors[chunk * tiles];
+    for (std::size_t i = count * chunk / chunks;
+         i < count * (chunk + 1) / chunks; i++) {
+      for_each_tile(i, [row](std::size_t tile) { row[tile]++; });
+    }
+  });
+  bins.offsets.assign(tiles + 1, 0);
+  std::size_t total = 0;
+  for (std::size_t tile = 0; tile < tiles; tile++) {
+    bins.offsets[tile] = total;
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+      std::size_t& cursor = cursors[chunk * tiles + tile];
+      std::size_t n = cursor;
+      cursor = total;
+      total += n;
+    }
+  }
+  bins.offsets[tiles] = total;
+  bins.items.resize(total);
+  pool.parallelFor(chunks, [&](std::size_t chunk) {
+    std::size_t* row = &cursors[chunk * tiles];
+    std::uint32_t* items = bins.items.data();
+    for (std::size_t i = count * chunk / chunks;
+         i < count * (chunk + 1) / chunks; i++) {
+      for_each_tile(i, [row, items, i](std::size_t tile) {
+        items[row[tile]++] = static_cast<std::uint32_t>(i);
+      });
+    }
+  });
+}
+
+void s21::Rasterizer::rasterizeTile(std::size_t index, const RenderStyle& style,
+                                    Image& image) const {
+  int x0 = static_cast<int>(index % tiles_x_) * tile_size_;
+  int y0 = static_cast<int>(index / tiles_x_) * tile_size_;
+  std::size_t side = tile_size_;
+  Tile tile{x0,
+            y0,
+            std::min(x0 + tile_size_, width_),
+            std::min(y0 + tile_size_, height_),
+            std::vector<float>(side * side, 1.f),
+            std::vector<Scalar>(side),
+            std::vector<Scalar>(side)};
+
+  std::uint32_t background = Image::pack(style.background);
+  for (int y = tile.y0; y < tile.y1; y++) {
+    for (int x = tile.x0; x < tile.x1; x++) image.set(x, y, background);
+  }
+  for (std::size_t i = point_bins_.offsets[index];
+       i < point_bins_.offsets[index + 1]; i++) {
+    drawPoint(points_[point_bins_.items[i]], style, tile, image);
+  }
+  for (std::size_t i = edge_bins_.offsets[index];
+       i < edge_bins_.offsets[index + 1]; i++) {
+    drawEdge(edges_[edge_bins_.items[i]], style, tile, image);
+  }
+}
+
+void s21::Rasterizer::drawPoint(const ScreenPoint& p, const RenderStyle& style,
+                                Tile& tile, Image& image) const {
+  double size = style.vertex_size;
+  double half = size / 2;
+  bool round = style.vertex_marker == VertexMarker::kRound;
+  std::uint32_t color = Image::pack(style.vertex_color);
+  int x0 = std::max(firstCenter(p.x - half), tile.x0);
+  int x1 = std::min(firstCenter(p.x + half), tile.x1);
+  int y0 = std::max(firstCenter(p.y - half), tile.y0);
+  int y1 = std::min(firstCenter(p.y + half), tile.y1);
+  for (int y = y0; y < y1; y++) {
+    for (int x = x0; x < x1; x++) {
+      if (round) {
+        // То же, что length(gl_PointCoord - 0.5) > 0.5 в шейдере
+        double u = (x + 0.5 - p.x) / size, v = (y + 0.5 - p.y) / size;
+        if (u * u + v * v > 0.25) continue;
+      }
+      plot(tile, x, y, p.depth, color, image);
+    }
+  }
+}
+
+void s21::Rasterizer::drawEdge(const ScreenEdge& e, const RenderStyle& style,
+                               Tile& tile, Image& image) const {
+  double dx = e.x1 - e.x0, dy = e.y1 - e.y0;
+  bool x_major = std::abs(dx) >= std::abs(dy);
+  double major0 = x_major ? e.x0 : e.y0, major1 = x_major ? e.x1 : e.y1;
+  double minor0 = x_major ? e.y0 : e.x0;
+  double span = major1 - major0;
+  if (span == 0) return;
+  double slope = (x_major ? dy : dx) / span;
+  int width = lineWidth(style);
+  std::uint32_t color = Image::pack(style.line_color);
+
+  int first = std::max(firstCenter(std::min(major0, major1)),
+                       x_major ? tile.x0 : tile.y0);
+  int last = std::min(firstCenter(std::max(major0, major1)),
+                      x_major ? tile.x1 : tile.y1);
+  if (first >= last) return;
+  int minor_lo = x_major ? tile.y0 : tile.x0;
+  int minor_hi = x_major ? tile.y1 : tile.x1;
+
+  // Поперечная координата и глубина всех шагов внутри плитки считаются
+  // векторным ядром, одинаково при любом разбиении на плитки
+  std::size_t steps = static_cast<std::size_t>(last - first);
+  Scalar* minor = tile.minor.data();
+  Scalar* depth = tile.fragment_depth.data();
+  for (std::size_t k = 0; k < steps; k++) {
+    minor[k] = depth[k] = static_cast<Scalar>(first + k + 0.5);
+  }
+  double depth_slope = (e.depth1 - e.depth0) / span;
+  const TransformKernels& kernels = transformKernels();
+  kernels.affine(minor, steps, static_cast<Scalar>(slope),
+                 static_cast<Scalar>(minor0 - slope * major0));
+  kernels.affine(depth, steps, static_cast<Scalar>(depth_slope),
+                 static_cast<Scalar>(e.depth0 - depth_slope * major0));
+
+  for (std::size_t k = 0; k < steps; k++) {
+    int i = first + static_cast<int>(k);
+    int column = static_cast<int>(std::floor(minor[k] - (width - 1) * 0.5));
+    int from = std::max(column, minor_lo);
+    int to = std::min(column + width, minor_hi);
+    for (int c = from; c < to; c++) {
+      int x = x_major ? i : c, y = x_major ? c : i;
+      if (style.dashed) {
+        double distance =
+            std::hypot(x + 0.5 - e.anchor_x, y + 0.5 - e.anchor_y);
+        if (std::fmod(distance, 2 * kDashLength) >= kDashLength) continue;
+      }
+      plot(tile, x, y, depth[k], color, image);
+    }
+  }
+}
+
+void s21::Rasterizer::plot(Tile& tile, int x, int y, double depth,
+                           std::uint32_t color, Image& image) const {
+  float& stored = tile.depth[static_cast<std::size_t>(y - tile.y0) *
+                                 tile_size_ +
+                             (x - tile.x0)];
+  if (!(depth < stored)) return;
+  stored = static_cast<float>(depth);
+  image.set(x, y, color);
+}
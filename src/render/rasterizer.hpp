@@ -0,0 +1,158 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_RENDER_RASTERIZER_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_RENDER_RASTERIZER_HPP_
+
+/************************************************************
+ * @file rasterizer.hpp
+ * @brief Программная отрисовка каркаса модели без OpenGL
+ ************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "../object/object.hpp"
+#include "../transformation/matrix.hpp"
+#include "image.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Вид вершин модели
+ ************************************************************/
+enum class VertexMarker { kNone, kRound, kSquare };
+
+/************************************************************
+ * @brief Настройки отрисовки, те же, что у окна просмотра
+ ************************************************************/
+struct RenderStyle {
+  Color background{0.f, 0.f, 0.f};
+  Color line_color{1.f, 1.f, 1.f};
+  float line_width = 1.f;
+  bool dashed = false;
+  Color vertex_color{1.f, 1.f, 1.f};
+  VertexMarker vertex_marker = VertexMarker::kNone;
+  float vertex_size = 2.f;  // В пикселях
+  bool parallel_projection = true;
+};
+
+/************************************************************
+ * @brief Матрица проекции окна просмотра
+ *
+ * Общая для OpenGL и программной отрисовки, чтобы они показывали модель
+ *одинаково.
+ * @param parallel Параллельная проекция, иначе центральная
+ ************************************************************/
+Matrix4 projectionMatrix(bool parallel);
+
+/************************************************************
+ * @brief Класс программной отрисовки каркаса модели
+ *
+ * Повторяет то, что рисует OpenGl::paintGL: вершины, затем ребра, с тестом
+ *глубины GL_LESS и отсечением по пирамиде видимости. Ребра растеризуются
+ *как неглаженые линии OpenGL: по шагу вдоль главной оси, как в алгоритме
+ *Брезенхэма, но с дробными концами, и толщиной в целое число пикселей
+ *поперек главной оси. Пунктир и круглые вершины считаются так же, как в
+ *шейдере окна. Не зависит ни от OpenGL, ни от Qt, поэтому работает на
+ *машинах без видеокарты и дисплея.
+ *
+ * Кадр рисуется по плиткам. Вершины проецируются векторными ядрами,
+ *ребра отсекаются и раскладываются по плиткам, которые они задевают, а
+ *плитки растеризуются параллельно в общем пуле потоков, каждая со своим
+ *буфером глубины, который помещается в кэш L1/L2. Ребра внутри плитки
+ *идут в исходном порядке, поэтому изображение не зависит ни от размера
+ *плитки, ни от количества потоков.
+ ************************************************************/
+class Rasterizer {
+ public:
+  /************************************************************
+   * @brief Конструктор
+   * @param tile_size Сторона плитки в пикселях
+   ************************************************************/
+  explicit Rasterizer(int tile_size = 128);
+
+  /************************************************************
+   * @brief Метод для отрисовки модели
+   *
+   * Если таблица ребер модели пуста, ребра строятся по полигонам.
+   * @param object Модель
+   * @param model Матрица модели, как Controller::modelMatrix
+   * @param style Настройки отрисовки
+   * @param image Куда рисовать, размер изображения задает область вывода
+   * @return void
+   ************************************************************/
+  void render(const Object& object, const Matrix4& model,
+              const RenderStyle& style, Image& image);
+
+ private:
+  /************************************************************
+   * @brief Вершина на экране: пиксели и глубина от 0 до 1
+   ************************************************************/
+  struct ScreenPoint {
+    float x, y, depth;
+    bool visible;
+  };
+
+  /************************************************************
+   * @brief Видимая часть ребра на экране
+   * @details anchor - вторая вершина ребра до отсечения, от нее
+   *отсчитывается пунктир
+   ************************************************************/
+  struct ScreenEdge {
+    float x0, y0, depth0;
+    float x1, y1, depth1;
+    float anchor_x, anchor_y;
+    bool visible;
+  };
+
+  /************************************************************
+   * @brief Номера вершин или ребер, разложенные по плиткам
+   * @details Плитка t владеет items[offsets[t]] ... items[offsets[t + 1]]
+   ************************************************************/
+  struct Bins {
+    std::vector<std::size_t> offsets;
+    std::vector<std::uint32_t> items;
+  };
+
+  /************************************************************
+   * @brief Буферы одной плитки во время растеризации
+   ************************************************************/
+  struct Tile {
+    int x0, y0, x1, y1;
+    std::vector<float> depth;
+    std::vector<Scalar> minor;
+    std::vector<Scalar> fragment_depth;
+  };
+
+  void project(const VertexArray& vertexes, const Matrix4& mvp);
+  void setupPoints();
+  void setupEdges(const EdgeTable& edges);
+  template <typename Visit>
+  void pointTiles(const ScreenPoint& p, float size, Visit visit) const;
+  template <typename Visit>
+  void edgeTiles(const ScreenEdge& e, int width, Visit visit) const;
+  template <typename ForEachTile>
+  void bin(std::size_t count, ForEachTile for_each_tile, Bins& bins) const;
+  void rasterizeTile(std::size_t index, const RenderStyle& style,
+                     Image& image) const;
+  void drawPoint(const ScreenPoint& p, const RenderStyle& style, Tile& tile,
+                 Image& image) const;
+  void drawEdge(const ScreenEdge& e, const RenderStyle& style, Tile& tile,
+                Image& image) const;
+  void plot(Tile& tile, int x, int y, double depth, std::uint32_t color,
+            Image& image) const;
+
+  int tile_size_;
+  int width_ = 0;
+  int height_ = 0;
+  int tiles_x_ = 0;
+  int tiles_y_ = 0;
+  std::vector<Scalar> clip_[4];  // Однородные координаты x, y, z, w
+  std::vector<ScreenPoint> points_;
+  std::vector<ScreenEdge> edges_;
+  Bins point_bins_;
+  Bins edge_bins_;
+  EdgeTable fallback_edges_;  // Ребра модели без таблицы ребер
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_RENDER_RASTERIZER_HPP_
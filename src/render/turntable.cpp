@@ -0,0 +1,39 @@
+#include "turntable.hpp"
+
+#include <algorithm>
+#include <utility>
+
+/************************************************************
+ * @file turntable.cpp
+ * @brief Кадры вращения модели для анимации без окна
+ ************************************************************/
+
+s21::Turntable::Turntable(Object object, const Matrix4& model,
+                          const TurntableSettings& settings)
+    : object_(std::move(object)), model_(model), settings_(settings) {
+  settings_.frames = std::max(settings_.frames, 0);
+  settings_.width = std::max(settings_.width, 1);
+  settings_.height = std::max(settings_.height, 1);
+}
+
+s21::Matrix4 s21::Turntable::frameMatrix(int frame) const {
+  return Matrix4::fromMovement(settings_.axis, settings_.step * frame) *
+         model_;
+}
+
+void s21::Turntable::renderFrame(int frame, Image& image) {
+  if (image.width() != settings_.width || image.height() != settings_.height) {
+    image = Image(settings_.width, settings_.height);
+  }
+  rasterizer_.render(object_, frameMatrix(frame), settings_.style, image);
+}
+
+bool s21::Turntable::run(
+    const std::function<bool(int frame, const Image& image)>& sink) {
+  Image image(settings_.width, settings_.height);
+  for (int frame = 0; frame < settings_.frames; frame++) {
+    renderFrame(frame, image);
+    if (!sink(frame, image)) return false;
+  }
+  return true;
+}
@@ -0,0 +1,92 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_RENDER_TURNTABLE_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_RENDER_TURNTABLE_HPP_
+
+/************************************************************
+ * @file turntable.hpp
+ * @brief Кадры вращения модели для анимации без окна
+ ************************************************************/
+
+#include <functional>
+
+#include "../object/object.hpp"
+#include "../transformation/matrix.hpp"
+#include "image.hpp"
+#include "rasterizer.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Настройки анимации вращения
+ *
+ * По умолчанию - полный оборот за 150 кадров, 5 секунд при 30 кадрах в
+ *секунду, как у прежней записи GIF с экрана.
+ ************************************************************/
+struct TurntableSettings {
+  int frames = 150;
+  double step = 2.4;        // Поворот между кадрами в градусах
+  Movement axis = RotateY;  // RotateX, RotateY или RotateZ
+  int width = 640;          // Размер кадра в пикселях
+  int height = 480;
+  int delay_ms = 33;  // Длительность кадра при воспроизведении
+  RenderStyle style;
+};
+
+/************************************************************
+ * @brief Класс для отрисовки кадров вращения модели
+ *
+ * Кадр i - это модель, повернутая на i * step градусов вокруг оси axis
+ *после матрицы модели, то есть вокруг оси экрана, как на поворотном
+ *столе. Кадры рисуются программно (Rasterizer) в изображение заданного
+ *размера, поэтому результат зависит только от модели и настроек: не от
+ *частоты кадров окна, его размера и действий пользователя. Кадры
+ *выдаются так быстро, как их рисует процессор, без привязки ко времени,
+ *а delay_ms только записывается в анимацию.
+ ************************************************************/
+class Turntable {
+ public:
+  /************************************************************
+   * @brief Конструктор
+   * @param object Копия модели, поэтому модель можно менять и загружать
+   *заново, пока идет запись
+   * @param model Матрица модели, как Controller::modelMatrix
+   * @param settings Настройки анимации
+   ************************************************************/
+  Turntable(Object object, const Matrix4& model,
+            const TurntableSettings& settings);
+
+  const TurntableSettings& settings() const { return settings_; }
+  int frameCount() const { return settings_.frames; }
+
+  /************************************************************
+   * @brief Матрица модели кадра frame
+   ************************************************************/
+  Matrix4 frameMatrix(int frame) const;
+
+  /************************************************************
+   * @brief Метод для отрисовки одного кадра
+   * @param frame Номер кадра
+   * @param image Куда рисовать, размер задается настройками
+   * @return void
+   ************************************************************/
+  void renderFrame(int frame, Image& image);
+
+  /************************************************************
+   * @brief Метод для отрисовки всех кадров по порядку
+   *
+   * Кадр передается в sink и перезаписывается следующим, поэтому sink
+   *должен скопировать или закодировать его сразу.
+   * @param sink Получатель кадров, false останавливает отрисовку
+   * @return true, если sink принял все кадры
+   ************************************************************/
+  bool run(const std::function<bool(int frame, const Image& image)>& sink);
+
+ private:
+  Object object_;
+  Matrix4 model_;
+  TurntableSettings settings_;
+  Rasterizer rasterizer_;
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_RENDER_TURNTABLE_HPP_
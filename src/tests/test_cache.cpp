@@ -0,0 +1,124 @@
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+#include "../cache/model_cache.hpp"
+#include "tests.hpp"
+
+namespace fs = std::filesystem;
+
+class CacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir = fs::temp_directory_path() / "s21_viewer_cache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    source = (dir / "model.obj").string();
+    fs::copy_file("tests/datasets/test3.obj", source);
+  }
+
+  void TearDown() override { fs::remove_all(dir); }
+
+  fs::path dir;
+  std::string source;
+};
+
+TEST_F(CacheTest, roundtrip) {
+  s21::ObjectParser parser;
+  s21::Object parsed;
+  parser.parseFile(parsed, source);
+
+  s21::ModelCache cache((dir / "cache").string());
+  s21::Object cached;
+  EXPECT_FALSE(cache.load(source, cached));
+  ASSERT_TRUE(cache.store(source, parsed));
+  ASSERT_TRUE(cache.load(source, cached, true));
+
+  ASSERT_EQ(parsed.vertexes.size(), cached.vertexes.size());
+  for (size_t i = 0; i < parsed.vertexes.size(); i++) {
+    EXPECT_EQ(parsed.vertexes[i].x, cached.vertexes[i].x);
+    EXPECT_EQ(parsed.vertexes[i].y, cached.vertexes[i].y);
+    EXPECT_EQ(parsed.vertexes[i].z, cached.vertexes[i].z);
+  }
+  ASSERT_EQ(parsed.lines.size(), cached.lines.size());
+  for (size_t i = 0; i < parsed.lines.size(); i++) {
+    EXPECT_EQ(parsed.lines[i].indexes, cached.lines[i].indexes);
+  }
+}
+
+TEST_F(CacheTest, keeps_open_polylines) {
+  std::ofstream(source, std::ios::app) << "l 1 2 3\n";
+  s21::ObjectParser parser;
+  s21::Object parsed;
+  parser.parseFile(parsed, source);
+  ASSERT_TRUE(parsed.lines.at(parsed.lines.size() - 1).open);
+
+  s21::ModelCache cache((dir / "cache").string());
+  ASSERT_TRUE(cache.store(source, parsed));
+  s21::Object cached;
+  ASSERT_TRUE(cache.load(source, cached));
+  ASSERT_EQ(cached.lines.size(), parsed.lines.size());
+  for (size_t i = 0; i < parsed.lines.size(); i++) {
+    EXPECT_EQ(cached.lines.isOpen(i), parsed.lines.isOpen(i));
+  }
+}
+
+TEST_F(CacheTest, store_stops_when_cancelled) {
+  s21::ObjectParser parser;
+  s21::Object parsed;
+  parser.parseFile(parsed, source);
+  s21::ModelCache cache((dir / "cache").string());
+  std::atomic<bool> cancelled{true};
+  EXPECT_FALSE(cache.store(source, parsed, &cancelled));
+  EXPECT_FALSE(fs::exists(cache.cachePath(source)));
+  EXPECT_FALSE(fs::exists(cache.cachePath(source) + ".tmp"));
+  s21::Object cached;
+  EXPECT_FALSE(cache.load(source, cached));
+}
+
+TEST_F(CacheTest, invalidated_by_source_change) {
+  s21::ObjectParser parser;
+  s21::Object parsed;
+  parser.parseFile(parsed, source);
+  s21::ModelCache cache((dir / "cache").string());
+  ASSERT_TRUE(cache.store(source, parsed));
+
+  std::ofstream(source, std::ios::app) << "v 9 9 9\n";
+  s21::Object cached;
+  EXPECT_FALSE(cache.load(source, cached));
+}
+
+TEST_F(CacheTest, rejects_unordered_face_offsets) {
+  s21::ObjectParser parser;
+  s21::Object parsed;
+  parser.parseFile(parsed, source);
+  s21::ModelCache cache((dir / "cache").string());
+  ASSERT_TRUE(cache.store(source, parsed));
+
+  // Первая и последняя границы верны, а вторая указывает за третью
+  std::string path = cache.cachePath(source);
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  s21::CacheHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  std::uint64_t offsets = sizeof(header) + (header.path_length + 7) / 8 * 8 +
+                          header.vertex_count * 3 * sizeof(s21::Scalar);
+  ASSERT_GE(header.face_count, 2u);
+  file.seekp(offsets + sizeof(std::uint64_t));
+  file.write(reinterpret_cast<const char*>(&header.index_count),
+             sizeof(std::uint64_t));
+  file.close();
+
+  s21::Object cached;
+  EXPECT_FALSE(cache.load(source, cached));
+  EXPECT_TRUE(cached.vertexes.empty());
+}
+
+TEST_F(CacheTest, controller_writes_and_reuses_cache) {
+  auto& controller = s21::Controller::getInstance();
+  std::string cache_dir = (dir / "cache").string();
+  EXPECT_FALSE(controller.parseFileCached(source, cache_dir));
+  EXPECT_TRUE(controller.parseFileCached(source, cache_dir));
+  EXPECT_EQ(controller.getObject().vertexes.size(), 6);
+  EXPECT_EQ(controller.getObject().lines.size(), 5);
+  controller.clearObject();
+}
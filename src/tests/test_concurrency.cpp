@@ -0,0 +1,152 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../concurrency/bounded_queue.hpp"
+#include "../concurrency/export_worker.hpp"
+#include "../concurrency/thread_pool.hpp"
+#include "tests.hpp"
+
+TEST(concurrency, parallel_for_rethrows) {
+  s21::ThreadPool pool(3);
+  constexpr std::size_t kCount = 1000;
+  std::atomic<std::size_t> started{0};
+  auto body = [&started](std::size_t i) {
+    started++;
+    if (i % 100 == 7) throw std::runtime_error("iteration");
+    std::this_thread::yield();
+  };
+  EXPECT_THROW(pool.parallelFor(kCount, body), std::runtime_error);
+  EXPECT_LE(started.load(), kCount);
+
+  // После исключения пул продолжает работать
+  std::atomic<std::size_t> sum{0};
+  pool.parallelFor(kCount, [&sum](std::size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), kCount * (kCount - 1) / 2);
+}
+
+TEST(concurrency, bounded_queue) {
+  s21::BoundedQueue<std::vector<int>> queue(2);
+  EXPECT_EQ(queue.capacity(), 2u);
+  EXPECT_TRUE(queue.push({1}));
+  std::vector<int> item{2, 2};
+  EXPECT_TRUE(queue.tryPush(item));
+  std::vector<int> rejected{3, 3, 3};
+  EXPECT_FALSE(queue.tryPush(rejected));
+  EXPECT_EQ(rejected.size(), 3u);  // Не перемещен в полную очередь
+  EXPECT_EQ(queue.size(), 2u);
+
+  EXPECT_EQ(queue.pop()->size(), 1u);
+  EXPECT_TRUE(queue.tryPush(rejected));
+  queue.close();
+  EXPECT_FALSE(queue.push({4}));
+  EXPECT_EQ(queue.pop()->size(), 2u);
+  EXPECT_EQ(queue.pop()->size(), 3u);
+  EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(concurrency, bounded_queue_backpressure) {
+  s21::BoundedQueue<int> queue(4);
+  constexpr int kItems = 10000;
+  std::atomic<std::size_t> largest{0};
+  std::thread producer([&queue, &largest] {
+    for (int i = 0; i < kItems; i++) {
+      queue.push(i);
+      std::size_t size = queue.size();
+      if (size > largest) largest = size;
+    }
+    queue.close();
+  });
+  int expected = 0;
+  bool ordered = true;
+  while (std::optional<int> item = queue.pop()) ordered &= *item == expected++;
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(expected, kItems);
+  EXPECT_LE(largest.load(), 4u);
+}
+
+TEST(concurrency, export_worker_frees_slot_before_done) {
+  // Запись GIF повторяет trySubmit из done: к этому моменту задача уже
+  // вынута из очереди, поэтому для отложенной задачи есть место
+  s21::ExportWorker worker(1);
+  std::promise<void> started, gate;
+  std::shared_future<void> opened = gate.get_future().share();
+  worker.submit({[&started, opened] {
+                   started.set_value();
+                   opened.wait();
+                   return true;
+                 },
+                 {}});
+  started.get_future().wait();
+
+  std::atomic<bool> ran{false};
+  std::atomic<int> retried{0};
+  s21::ExportTask retained{[&ran] { return ran = true; }, {}};
+  s21::ExportTask queued{[] { return true; }, [&](bool) {
+                           retried += worker.trySubmit(retained);
+                         }};
+  ASSERT_TRUE(worker.trySubmit(queued));
+  EXPECT_FALSE(worker.trySubmit(retained));
+  gate.set_value();
+  worker.wait();
+  EXPECT_EQ(retried.load(), 1);
+  EXPECT_TRUE(ran.load());
+}
+
+TEST(concurrency, export_worker) {
+  std::vector<int> order;
+  std::atomic<int> succeeded{0}, failed{0};
+  std::promise<void> gate;
+  std::shared_future<void> opened = gate.get_future().share();
+  {
+    s21::ExportWorker worker(2);
+    EXPECT_EQ(worker.capacity(), 2u);
+    // Первая задача занимает поток, пока не открыт gate
+    worker.submit({[opened, &order] {
+                     opened.wait();
+                     order.push_back(0);
+                     return true;
+                   },
+                   [&succeeded](bool ok) { succeeded += ok; }});
+    auto probe = [&order, &failed] {
+      return s21::ExportTask{[&order] {
+                               order.push_back(1);
+                               return false;
+                             },
+                             [&failed](bool ok) { failed += !ok; }};
+    };
+    // Поток занят, поэтому очередь заполняется, и trySubmit отказывает
+    int accepted = 0;
+    s21::ExportTask task = probe();
+    while (worker.trySubmit(task)) {
+      accepted++;
+      task = probe();
+    }
+    EXPECT_TRUE(static_cast<bool>(task.run));  // Задача осталась у нас
+    EXPECT_GE(accepted, 1);
+    EXPECT_LE(accepted, 2);
+    EXPECT_EQ(worker.pending(), static_cast<std::size_t>(accepted) + 1);
+    gate.set_value();
+    worker.wait();
+    EXPECT_EQ(worker.pending(), 0u);
+    EXPECT_EQ(succeeded.load(), 1);
+    ASSERT_FALSE(order.empty());
+    EXPECT_EQ(order[0], 0);
+    EXPECT_EQ(failed.load(), accepted);
+    EXPECT_EQ(order.size(), static_cast<std::size_t>(accepted) + 1);
+
+    // Деструктор выполняет оставшиеся задачи
+    for (int i = 0; i < 5; i++) {
+      worker.submit({[&order, i] {
+                       order.push_back(10 + i);
+                       return true;
+                     },
+                     {}});
+    }
+  }
+  ASSERT_GE(order.size(), 5u);
+  for (int i = 0; i < 5; i++) EXPECT_EQ(order[order.size() - 5 + i], 10 + i);
+}
@@ -0,0 +1,286 @@
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <utility>
+
+#include "../loader/async_loader.hpp"
+#include "tests.hpp"
+
+TEST(loader, async_load_and_commit) {
+  s21::AsyncLoader loader;
+  s21::Object object;
+  object.vertexes.emplace_back(1, 2, 3);
+
+  loader.start("tests/datasets/test1.obj");
+  loader.wait();
+  ASSERT_EQ(loader.state(), s21::LoadState::kFinished);
+  EXPECT_EQ(object.vertexes.size(), 1);
+  EXPECT_EQ(loader.progress().records, 14);
+  EXPECT_EQ(loader.progress().bytes, loader.progress().total_bytes);
+
+  ASSERT_TRUE(loader.takeResult(object));
+  EXPECT_EQ(loader.state(), s21::LoadState::kIdle);
+  ASSERT_EQ(object.vertexes.size(), 8);
+  EXPECT_EQ(object.lines.size(), 6);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(0).x, 0.5);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(0).z, -0.5);
+  EXPECT_FALSE(loader.takeResult(object));
+}
+
+TEST(loader, object_moves_without_copying) {
+  s21::Object object;
+  s21::ObjectParser().parseFile(object, "tests/datasets/test1.obj");
+  object.edges.build(object.lines, object.vertexes.size());
+  ASSERT_FALSE(object.edges.empty());
+  const s21::Scalar* x = object.vertexes.x();
+  const int* indexes = object.lines.indexes();
+  const s21::Edge* edges = object.edges.data();
+
+  s21::Object moved(std::move(object));
+  EXPECT_EQ(moved.vertexes.x(), x);
+  EXPECT_EQ(moved.lines.indexes(), indexes);
+  EXPECT_EQ(moved.edges.data(), edges);
+  EXPECT_TRUE(object.vertexes.empty());
+  EXPECT_EQ(object.lines.size(), 0u);
+  EXPECT_EQ(object.lines.indexCount(), 0u);
+  EXPECT_TRUE(object.edges.empty());
+
+  object = std::move(moved);
+  EXPECT_EQ(object.vertexes.x(), x);
+  EXPECT_EQ(object.lines.indexes(), indexes);
+  EXPECT_EQ(object.lines.size(), 6u);
+  EXPECT_TRUE(moved.vertexes.empty());
+  EXPECT_EQ(moved.lines.size(), 0u);
+  EXPECT_TRUE(moved.edges.empty());
+}
+
+TEST(loader, batches_move_without_copying) {
+  // Так же пачки забирает AsyncLoader::publish
+  std::vector<s21::Object> batches;
+  std::vector<const s21::Scalar*> published;
+  s21::ObjectParser parser;
+  parser.setBatchHandler([&](s21::Object& batch) {
+    published.push_back(batch.vertexes.x());
+    batches.push_back(std::move(batch));
+    EXPECT_TRUE(batch.vertexes.empty());
+  });
+  s21::Object object;
+  parser.parseFile(object, "tests/datasets/test1.obj");
+  ASSERT_FALSE(batches.empty());
+  for (std::size_t i = 0; i < batches.size(); i++) {
+    EXPECT_EQ(batches[i].vertexes.x(), published[i]);
+  }
+}
+
+TEST(loader, missing_file_fails) {
+  s21::AsyncLoader loader;
+  loader.start("tests/datasets/missing.obj");
+  loader.wait();
+  EXPECT_EQ(loader.state(), s21::LoadState::kFailed);
+}
+
+TEST(loader, cancel) {
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_viewer_big.obj").string();
+  {
+    std::ofstream file(path);
+    for (int i = 0; i < 200000; i++) file << "v " << i << " 1 2\n";
+  }
+  s21::AsyncLoader loader;
+  loader.start(path);
+  loader.cancel();
+  EXPECT_EQ(loader.state(), s21::LoadState::kCancelled);
+  s21::Object object;
+  EXPECT_FALSE(loader.takeResult(object));
+  EXPECT_TRUE(object.vertexes.empty());
+  std::filesystem::remove(path);
+}
+
+TEST(loader, streaming_batches) {
+  std::string buffer;
+  for (int i = 0; i < 40000; i++) {
+    buffer += "v " + std::to_string(i) + " 0 0\n";
+    if (i % 2 == 1) buffer += "f -2 -1 " + std::to_string(i + 1) + "\n";
+  }
+  s21::ObjectParser parser;
+  s21::Object serial, streamed, object;
+  parser.parseBuffer(serial, buffer);
+
+  int batches = 0;
+  parser.setBatchHandler([&](s21::Object& batch) {
+    batches++;
+    streamed.vertexes.append(batch.vertexes);
+    streamed.lines.append(batch.lines);
+  });
+  parser.parseBuffer(object, buffer);
+  EXPECT_GT(batches, 1);
+  EXPECT_TRUE(object.vertexes.empty());
+  ASSERT_EQ(streamed.vertexes.size(), serial.vertexes.size());
+  ASSERT_EQ(streamed.lines.size(), serial.lines.size());
+  for (size_t i = 0; i < serial.lines.size(); i++) {
+    EXPECT_EQ(serial.lines[i].indexes, streamed.lines[i].indexes);
+  }
+}
+
+TEST(loader, pipeline_matches_separate_steps) {
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_viewer_pipeline.obj")
+          .string();
+  {
+    std::ofstream file(path);
+    // Полигон ссылается на вершины, объявленные позже
+    file << "f 1 2 40001\n";
+    for (int i = 0; i < 40000; i++) {
+      file << "v " << i << ' ' << i % 11 << " -" << i % 5 << "\n";
+      if (i % 2 == 1) file << "f -2 -1 " << i + 1 << " 1\n";
+    }
+    file << "v 1 1 1\n";
+  }
+  s21::ManipulationFacade model;
+  s21::Object expected;
+  model.parseFile(expected, path);
+  model.Normalization(expected.vertexes);
+  expected.edges.build(expected.lines, expected.vertexes.size());
+
+  s21::ParseProgress progress;
+  s21::LoadPipeline pipeline(&progress);
+  s21::Object object;
+  ASSERT_TRUE(pipeline.load(path, object));
+  const s21::LoadReport& report = pipeline.report();
+  EXPECT_FALSE(report.cached);
+  EXPECT_EQ(report.vertexes, expected.vertexes.size());
+  EXPECT_EQ(report.faces, expected.lines.size());
+  EXPECT_EQ(report.indexes, expected.lines.indexCount());
+  EXPECT_EQ(report.edges, expected.edges.size());
+  EXPECT_GE(report.total_ms, report.parse_ms);
+  EXPECT_EQ(progress.bytes, progress.total_bytes);
+
+  ASSERT_EQ(object.vertexes.size(), expected.vertexes.size());
+  for (size_t i = 0; i < object.vertexes.size(); i++) {
+    EXPECT_EQ(object.vertexes.x()[i], expected.vertexes.x()[i]);
+    EXPECT_EQ(object.vertexes.y()[i], expected.vertexes.y()[i]);
+  }
+  std::set<std::pair<uint32_t, uint32_t>> edges, expected_edges;
+  for (const s21::Edge& edge : object.edges) edges.emplace(edge.a, edge.b);
+  for (const s21::Edge& edge : expected.edges) {
+    expected_edges.emplace(edge.a, edge.b);
+  }
+  EXPECT_EQ(edges, expected_edges);
+  EXPECT_EQ(edges.count({0, 1}), 1u);
+
+  // Из кэша прогресс тоже доходит до размера файла
+  std::string cache_dir = path + ".cache";
+  ASSERT_TRUE(s21::LoadPipeline(&progress).load(path, object, cache_dir));
+  s21::ParseProgress cached_progress;
+  s21::LoadPipeline cached(&cached_progress);
+  ASSERT_TRUE(cached.load(path, object, cache_dir));
+  EXPECT_TRUE(cached.report().cached);
+  EXPECT_EQ(cached_progress.total_bytes, std::filesystem::file_size(path));
+  EXPECT_EQ(cached_progress.bytes, cached_progress.total_bytes);
+  std::filesystem::remove_all(cache_dir);
+  std::filesystem::remove(path);
+}
+
+TEST(loader, controller_streaming) {
+  auto& controller = s21::Controller::getInstance();
+  controller.parseFileStreaming("tests/datasets/test1.obj");
+  EXPECT_TRUE(controller.isStreaming());
+  EXPECT_TRUE(controller.getObject().vertexes.empty());
+  while (!controller.commitLoadedModel()) {
+    ASSERT_TRUE(controller.isStreaming());
+    std::this_thread::yield();
+  }
+  EXPECT_FALSE(controller.isStreaming());
+  auto& object = controller.getObject();
+  ASSERT_EQ(object.vertexes.size(), 8);
+  EXPECT_EQ(object.lines.size(), 6);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(0).x, 0.5);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(0).z, -0.5);
+  controller.clearObject();
+}
+
+TEST(loader, controller_streaming_queues_transforms) {
+  auto& controller = s21::Controller::getInstance();
+  controller.parseFileStreaming("tests/datasets/test1.obj");
+  ASSERT_TRUE(controller.isStreaming());
+  // Вершины еще не нормализованы, поэтому сдвиг откладывается до конца
+  controller.TransformModel(s21::MoveX, 1);
+  controller.TransformBatch({{s21::MoveZ, 2}});
+  while (!controller.commitLoadedModel()) std::this_thread::yield();
+  EXPECT_TRUE(controller.pendingTransform().isIdentity());
+  auto& object = controller.getObject();
+  ASSERT_EQ(object.vertexes.size(), 8);
+  EXPECT_NEAR(object.vertexes.at(0).x, 1.5, 1e-6);
+  EXPECT_NEAR(object.vertexes.at(0).z, 1.5, 1e-6);
+  controller.clearObject();
+}
+
+TEST(loader, streaming_stores_cache) {
+  namespace fs = std::filesystem;
+  fs::path dir = fs::temp_directory_path() / "s21_viewer_streaming_cache";
+  fs::remove_all(dir);
+  std::string cache_dir = (dir / "cache").string();
+
+  s21::AsyncLoader loader;
+  s21::Object object;
+  loader.start("tests/datasets/test1.obj", cache_dir, true);
+  while (!loader.takeResult(object)) loader.takeBatches(object);
+  object.lines.validate(object.vertexes.size());
+  loader.storeCache(object);
+  loader.wait();
+
+  s21::Object cached;
+  ASSERT_TRUE(s21::ModelCache(cache_dir).load("tests/datasets/test1.obj",
+                                              cached));
+  EXPECT_EQ(cached.vertexes.size(), object.vertexes.size());
+  EXPECT_EQ(cached.lines.size(), object.lines.size());
+
+  // Модель из кэша не записывается повторно, а прогресс знает размер файла
+  s21::Object again;
+  loader.start("tests/datasets/test1.obj", cache_dir, true);
+  while (!loader.takeResult(again)) loader.takeBatches(again);
+  EXPECT_EQ(loader.progress().total_bytes.load(),
+            fs::file_size("tests/datasets/test1.obj"));
+  EXPECT_EQ(loader.progress().bytes.load(),
+            loader.progress().total_bytes.load());
+  fs::remove_all(dir);
+  loader.storeCache(again);
+  loader.wait();
+  EXPECT_FALSE(fs::exists(dir));
+}
+
+TEST(loader, controller_streaming_only_appends) {
+  auto& controller = s21::Controller::getInstance();
+  controller.parseFileStreaming("tests/datasets/test1.obj");
+  std::uint64_t rewrite = controller.rewriteRevision();
+  while (controller.isStreaming()) {
+    if (!controller.commitLoadedModel() && controller.isStreaming()) {
+      EXPECT_EQ(controller.rewriteRevision(), rewrite);
+    }
+    std::this_thread::yield();
+  }
+  // Нормализация в конце загрузки переписывает вершины
+  EXPECT_NE(controller.rewriteRevision(), rewrite);
+  controller.clearObject();
+}
+
+TEST(loader, streaming_drops_transforms_queued_for_previous_model) {
+  auto& controller = s21::Controller::getInstance();
+  controller.parseFile("tests/datasets/test1.obj");
+  controller.queueTransform(s21::MoveX, 1);
+  controller.queueTransform(s21::RotateY, 30);
+  controller.applyQueuedTransforms();
+  // Сброс ползунков перед загрузкой ставит обратные преобразования
+  controller.queueTransform(s21::MoveX, -1);
+  controller.queueTransform(s21::RotateY, -30);
+
+  controller.parseFileStreaming("tests/datasets/test1.obj");
+  controller.applyQueuedTransforms();
+  EXPECT_TRUE(controller.modelMatrix().isIdentity());
+  EXPECT_TRUE(controller.pendingTransform().isIdentity());
+  while (!controller.commitLoadedModel()) std::this_thread::yield();
+  EXPECT_TRUE(controller.modelMatrix().isIdentity());
+  EXPECT_SCALAR_EQ(controller.getObject().vertexes.at(0).x, 0.5);
+  EXPECT_SCALAR_EQ(controller.getObject().vertexes.at(0).z, -0.5);
+  controller.clearObject();
+}
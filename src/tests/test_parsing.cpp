@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <set>
+
 #include "tests.hpp"
 
 TEST(parsing, test_1) {
@@ -6,68 +9,68 @@ TEST(parsing, test_1) {
   auto& object = controller.getObject();
   auto& points = object.vertexes;
 
-  EXPECT_DOUBLE_EQ(points.size(), 8);
-  EXPECT_DOUBLE_EQ(points.at(0).x, 1);
-  EXPECT_DOUBLE_EQ(points.at(0).y, 1);
-  EXPECT_DOUBLE_EQ(points.at(0).z, -1);
+  EXPECT_SCALAR_EQ(points.size(), 8);
+  EXPECT_SCALAR_EQ(points.at(0).x, 1);
+  EXPECT_SCALAR_EQ(points.at(0).y, 1);
+  EXPECT_SCALAR_EQ(points.at(0).z, -1);
 
-  EXPECT_DOUBLE_EQ(points.at(1).x, 1);
-  EXPECT_DOUBLE_EQ(points.at(1).y, -1);
-  EXPECT_DOUBLE_EQ(points.at(1).z, -1);
+  EXPECT_SCALAR_EQ(points.at(1).x, 1);
+  EXPECT_SCALAR_EQ(points.at(1).y, -1);
+  EXPECT_SCALAR_EQ(points.at(1).z, -1);
 
-  EXPECT_DOUBLE_EQ(points.at(2).x, -1);
-  EXPECT_DOUBLE_EQ(points.at(2).y, -1);
-  EXPECT_DOUBLE_EQ(points.at(2).z, -1);
+  EXPECT_SCALAR_EQ(points.at(2).x, -1);
+  EXPECT_SCALAR_EQ(points.at(2).y, -1);
+  EXPECT_SCALAR_EQ(points.at(2).z, -1);
 
-  EXPECT_DOUBLE_EQ(points.at(3).x, -1);
-  EXPECT_DOUBLE_EQ(points.at(3).y, 1);
-  EXPECT_DOUBLE_EQ(points.at(3).z, -1);
+  EXPECT_SCALAR_EQ(points.at(3).x, -1);
+  EXPECT_SCALAR_EQ(points.at(3).y, 1);
+  EXPECT_SCALAR_EQ(points.at(3).z, -1);
 
-  EXPECT_DOUBLE_EQ(points.at(4).x, 1);
-  EXPECT_DOUBLE_EQ(points.at(4).y, 1);
-  EXPECT_DOUBLE_EQ(points.at(4).z, 1);
+  EXPECT_SCALAR_EQ(points.at(4).x, 1);
+  EXPECT_SCALAR_EQ(points.at(4).y, 1);
+  EXPECT_SCALAR_EQ(points.at(4).z, 1);
 
-  EXPECT_DOUBLE_EQ(points.at(5).x, 1);
-  EXPECT_DOUBLE_EQ(points.at(5).y, -1);
-  EXPECT_DOUBLE_EQ(points.at(5).z, 1);
+  EXPECT_SCALAR_EQ(points.at(5).x, 1);
+  EXPECT_SCALAR_EQ(points.at(5).y, -1);
+  EXPECT_SCALAR_EQ(points.at(5).z, 1);
 
-  EXPECT_DOUBLE_EQ(points.at(6).x, -1);
-  EXPECT_DOUBLE_EQ(points.at(6).y, -1);
-  EXPECT_DOUBLE_EQ(points.at(6).z, 1);
+  EXPECT_SCALAR_EQ(points.at(6).x, -1);
+  EXPECT_SCALAR_EQ(points.at(6).y, -1);
+  EXPECT_SCALAR_EQ(points.at(6).z, 1);
 
-  EXPECT_DOUBLE_EQ(points.at(7).x, -1);
-  EXPECT_DOUBLE_EQ(points.at(7).y, 1);
-  EXPECT_DOUBLE_EQ(points.at(7).z, 1);
+  EXPECT_SCALAR_EQ(points.at(7).x, -1);
+  EXPECT_SCALAR_EQ(points.at(7).y, 1);
+  EXPECT_SCALAR_EQ(points.at(7).z, 1);
 
   auto& facets = object.lines;
 
   EXPECT_EQ(facets.at(0).indexes.size(), 4);
-  EXPECT_EQ(facets.at(0).indexes.at(0), 1);
-  EXPECT_EQ(facets.at(0).indexes.at(1), 2);
-  EXPECT_EQ(facets.at(0).indexes.at(2), 3);
-  EXPECT_EQ(facets.at(0).indexes.at(3), 4);
+  EXPECT_EQ(facets.at(0).indexes.at(0), 0);
+  EXPECT_EQ(facets.at(0).indexes.at(1), 1);
+  EXPECT_EQ(facets.at(0).indexes.at(2), 2);
+  EXPECT_EQ(facets.at(0).indexes.at(3), 3);
 
   EXPECT_EQ(facets.at(1).indexes.size(), 4);
-  EXPECT_EQ(facets.at(1).indexes.at(0), 5);
-  EXPECT_EQ(facets.at(1).indexes.at(1), 6);
-  EXPECT_EQ(facets.at(1).indexes.at(2), 7);
-  EXPECT_EQ(facets.at(1).indexes.at(3), 8);
+  EXPECT_EQ(facets.at(1).indexes.at(0), 4);
+  EXPECT_EQ(facets.at(1).indexes.at(1), 5);
+  EXPECT_EQ(facets.at(1).indexes.at(2), 6);
+  EXPECT_EQ(facets.at(1).indexes.at(3), 7);
 
   EXPECT_EQ(facets.at(2).indexes.size(), 2);
-  EXPECT_EQ(facets.at(2).indexes.at(0), 1);
-  EXPECT_EQ(facets.at(2).indexes.at(1), 5);
+  EXPECT_EQ(facets.at(2).indexes.at(0), 0);
+  EXPECT_EQ(facets.at(2).indexes.at(1), 4);
 
   EXPECT_EQ(facets.at(3).indexes.size(), 2);
-  EXPECT_EQ(facets.at(3).indexes.at(0), 2);
-  EXPECT_EQ(facets.at(3).indexes.at(1), 6);
+  EXPECT_EQ(facets.at(3).indexes.at(0), 1);
+  EXPECT_EQ(facets.at(3).indexes.at(1), 5);
 
   EXPECT_EQ(facets.at(4).indexes.size(), 2);
-  EXPECT_EQ(facets.at(4).indexes.at(0), 3);
-  EXPECT_EQ(facets.at(4).indexes.at(1), 7);
+  EXPECT_EQ(facets.at(4).indexes.at(0), 2);
+  EXPECT_EQ(facets.at(4).indexes.at(1), 6);
 
   EXPECT_EQ(facets.at(5).indexes.size(), 2);
-  EXPECT_EQ(facets.at(5).indexes.at(0), 4);
-  EXPECT_EQ(facets.at(5).indexes.at(1), 8);
+  EXPECT_EQ(facets.at(5).indexes.at(0), 3);
+  EXPECT_EQ(facets.at(5).indexes.at(1), 7);
 }
 
 TEST(parsing, test_2) {
@@ -77,41 +80,41 @@ TEST(parsing, test_2) {
   auto& object = controller.getObject();
   auto& points = object.vertexes;
 
-  EXPECT_DOUBLE_EQ(points.at(0).x, 1);
-  EXPECT_DOUBLE_EQ(points.at(0).y, 2);
-  EXPECT_DOUBLE_EQ(points.at(0).z, 3);
+  EXPECT_SCALAR_EQ(points.at(0).x, 1);
+  EXPECT_SCALAR_EQ(points.at(0).y, 2);
+  EXPECT_SCALAR_EQ(points.at(0).z, 3);
 
-  EXPECT_DOUBLE_EQ(points.at(1).x, 2);
-  EXPECT_DOUBLE_EQ(points.at(1).y, 3);
-  EXPECT_DOUBLE_EQ(points.at(1).z, 4);
+  EXPECT_SCALAR_EQ(points.at(1).x, 2);
+  EXPECT_SCALAR_EQ(points.at(1).y, 3);
+  EXPECT_SCALAR_EQ(points.at(1).z, 4);
 
-  EXPECT_DOUBLE_EQ(points.at(2).x, 3);
-  EXPECT_DOUBLE_EQ(points.at(2).y, 4);
-  EXPECT_DOUBLE_EQ(points.at(2).z, 5);
+  EXPECT_SCALAR_EQ(points.at(2).x, 3);
+  EXPECT_SCALAR_EQ(points.at(2).y, 4);
+  EXPECT_SCALAR_EQ(points.at(2).z, 5);
 
-  EXPECT_DOUBLE_EQ(points.at(3).x, 4);
-  EXPECT_DOUBLE_EQ(points.at(3).y, 5);
-  EXPECT_DOUBLE_EQ(points.at(3).z, 6);
+  EXPECT_SCALAR_EQ(points.at(3).x, 4);
+  EXPECT_SCALAR_EQ(points.at(3).y, 5);
+  EXPECT_SCALAR_EQ(points.at(3).z, 6);
 
-  EXPECT_DOUBLE_EQ(points.at(4).x, 5);
-  EXPECT_DOUBLE_EQ(points.at(4).y, 6);
-  EXPECT_DOUBLE_EQ(points.at(4).z, 7);
+  EXPECT_SCALAR_EQ(points.at(4).x, 5);
+  EXPECT_SCALAR_EQ(points.at(4).y, 6);
+  EXPECT_SCALAR_EQ(points.at(4).z, 7);
 
-  EXPECT_DOUBLE_EQ(points.at(5).x, 6);
-  EXPECT_DOUBLE_EQ(points.at(5).y, 7);
-  EXPECT_DOUBLE_EQ(points.at(5).z, 8);
+  EXPECT_SCALAR_EQ(points.at(5).x, 6);
+  EXPECT_SCALAR_EQ(points.at(5).y, 7);
+  EXPECT_SCALAR_EQ(points.at(5).z, 8);
 
   auto& facets = object.lines;
 
   EXPECT_EQ(facets.at(0).indexes.size(), 3);
-  EXPECT_EQ(facets.at(0).indexes.at(0), 1);
-  EXPECT_EQ(facets.at(0).indexes.at(1), 2);
-  EXPECT_EQ(facets.at(0).indexes.at(2), 3);
+  EXPECT_EQ(facets.at(0).indexes.at(0), 0);
+  EXPECT_EQ(facets.at(0).indexes.at(1), 1);
+  EXPECT_EQ(facets.at(0).indexes.at(2), 2);
 
   EXPECT_EQ(facets.at(1).indexes.size(), 3);
-  EXPECT_EQ(facets.at(1).indexes.at(0), 4);
-  EXPECT_EQ(facets.at(1).indexes.at(1), 5);
-  EXPECT_EQ(facets.at(1).indexes.at(2), 6);
+  EXPECT_EQ(facets.at(1).indexes.at(0), 3);
+  EXPECT_EQ(facets.at(1).indexes.at(1), 4);
+  EXPECT_EQ(facets.at(1).indexes.at(2), 5);
 }
 
 TEST(parsing, test_3) {
@@ -121,51 +124,354 @@ TEST(parsing, test_3) {
   auto& object = controller.getObject();
   auto& points = object.vertexes;
 
-  EXPECT_DOUBLE_EQ(points.at(0).x, 1.5);
-  EXPECT_DOUBLE_EQ(points.at(0).y, 2.1);
-  EXPECT_DOUBLE_EQ(points.at(0).z, 3.9);
+  EXPECT_SCALAR_EQ(points.at(0).x, 1.5);
+  EXPECT_SCALAR_EQ(points.at(0).y, 2.1);
+  EXPECT_SCALAR_EQ(points.at(0).z, 3.9);
 
-  EXPECT_DOUBLE_EQ(points.at(1).x, 2.1);
-  EXPECT_DOUBLE_EQ(points.at(1).y, 3.5);
-  EXPECT_DOUBLE_EQ(points.at(1).z, 4.2);
+  EXPECT_SCALAR_EQ(points.at(1).x, 2.1);
+  EXPECT_SCALAR_EQ(points.at(1).y, 3.5);
+  EXPECT_SCALAR_EQ(points.at(1).z, 4.2);
 
-  EXPECT_DOUBLE_EQ(points.at(2).x, 3.12);
-  EXPECT_DOUBLE_EQ(points.at(2).y, 4.1);
-  EXPECT_DOUBLE_EQ(points.at(2).z, 5.4);
+  EXPECT_SCALAR_EQ(points.at(2).x, 3.12);
+  EXPECT_SCALAR_EQ(points.at(2).y, 4.1);
+  EXPECT_SCALAR_EQ(points.at(2).z, 5.4);
 
-  EXPECT_DOUBLE_EQ(points.at(3).x, 4.132);
-  EXPECT_DOUBLE_EQ(points.at(3).y, 5.132);
-  EXPECT_DOUBLE_EQ(points.at(3).z, 6.33);
+  EXPECT_SCALAR_EQ(points.at(3).x, 4.132);
+  EXPECT_SCALAR_EQ(points.at(3).y, 5.132);
+  EXPECT_SCALAR_EQ(points.at(3).z, 6.33);
 
-  EXPECT_DOUBLE_EQ(points.at(4).x, 5.642);
-  EXPECT_DOUBLE_EQ(points.at(4).y, 6.13);
-  EXPECT_DOUBLE_EQ(points.at(4).z, 7.15);
+  EXPECT_SCALAR_EQ(points.at(4).x, 5.642);
+  EXPECT_SCALAR_EQ(points.at(4).y, 6.13);
+  EXPECT_SCALAR_EQ(points.at(4).z, 7.15);
 
-  EXPECT_DOUBLE_EQ(points.at(5).x, 6.62);
-  EXPECT_DOUBLE_EQ(points.at(5).y, 7.342);
-  EXPECT_DOUBLE_EQ(points.at(5).z, 8.74);
+  EXPECT_SCALAR_EQ(points.at(5).x, 6.62);
+  EXPECT_SCALAR_EQ(points.at(5).y, 7.342);
+  EXPECT_SCALAR_EQ(points.at(5).z, 8.74);
 
   auto& facets = object.lines;
 
   EXPECT_EQ(facets.at(0).indexes.size(), 3);
-  EXPECT_EQ(facets.at(0).indexes.at(0), 1);
-  EXPECT_EQ(facets.at(0).indexes.at(1), 2);
-  EXPECT_EQ(facets.at(0).indexes.at(2), 3);
+  EXPECT_EQ(facets.at(0).indexes.at(0), 0);
+  EXPECT_EQ(facets.at(0).indexes.at(1), 1);
+  EXPECT_EQ(facets.at(0).indexes.at(2), 2);
 
   EXPECT_EQ(facets.at(1).indexes.size(), 3);
-  EXPECT_EQ(facets.at(1).indexes.at(0), 4);
-  EXPECT_EQ(facets.at(1).indexes.at(1), 5);
-  EXPECT_EQ(facets.at(1).indexes.at(2), 6);
+  EXPECT_EQ(facets.at(1).indexes.at(0), 3);
+  EXPECT_EQ(facets.at(1).indexes.at(1), 4);
+  EXPECT_EQ(facets.at(1).indexes.at(2), 5);
 
   EXPECT_EQ(facets.at(2).indexes.size(), 2);
-  EXPECT_EQ(facets.at(2).indexes.at(0), 1);
-  EXPECT_EQ(facets.at(2).indexes.at(1), 4);
+  EXPECT_EQ(facets.at(2).indexes.at(0), 0);
+  EXPECT_EQ(facets.at(2).indexes.at(1), 3);
 
   EXPECT_EQ(facets.at(3).indexes.size(), 2);
-  EXPECT_EQ(facets.at(3).indexes.at(0), 2);
-  EXPECT_EQ(facets.at(3).indexes.at(1), 5);
+  EXPECT_EQ(facets.at(3).indexes.at(0), 1);
+  EXPECT_EQ(facets.at(3).indexes.at(1), 4);
 
   EXPECT_EQ(facets.at(4).indexes.size(), 2);
-  EXPECT_EQ(facets.at(4).indexes.at(0), 3);
-  EXPECT_EQ(facets.at(4).indexes.at(1), 6);
-}
\ No newline at end of file
+  EXPECT_EQ(facets.at(4).indexes.at(0), 2);
+  EXPECT_EQ(facets.at(4).indexes.at(1), 5);
+}
+
+TEST(parsing, mapped_matches_stream) {
+  s21::ObjectParser parser;
+  s21::Object stream, mapped;
+  parser.parseFile(stream, "tests/datasets/test3.obj", s21::ParseMode::kStream);
+  parser.parseFile(mapped, "tests/datasets/test3.obj", s21::ParseMode::kMapped);
+
+  ASSERT_EQ(stream.vertexes.size(), mapped.vertexes.size());
+  for (size_t i = 0; i < stream.vertexes.size(); i++) {
+    EXPECT_EQ(stream.vertexes.at(i).x, mapped.vertexes.at(i).x);
+    EXPECT_EQ(stream.vertexes.at(i).y, mapped.vertexes.at(i).y);
+    EXPECT_EQ(stream.vertexes.at(i).z, mapped.vertexes.at(i).z);
+  }
+  ASSERT_EQ(stream.lines.size(), mapped.lines.size());
+  for (size_t i = 0; i < stream.lines.size(); i++) {
+    EXPECT_EQ(stream.lines.at(i).indexes, mapped.lines.at(i).indexes);
+  }
+}
+
+TEST(parsing, buffer_without_trailing_newline) {
+  s21::ObjectParser parser;
+  s21::Object object;
+  parser.parseBuffer(object, "v 1 2 3\r\nv -4 +5 6e1\r\nf 1/2/3 2//1");
+
+  ASSERT_EQ(object.vertexes.size(), 2);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(1).x, -4);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(1).y, 5);
+  EXPECT_DOUBLE_EQ(object.vertexes.at(1).z, 60);
+  ASSERT_EQ(object.lines.size(), 1);
+  EXPECT_EQ(object.lines.at(0).indexes, std::vector<int>({0, 1}));
+}
+
+TEST(parsing, missing_file) {
+  s21::ObjectParser parser;
+  s21::Object object;
+  parser.parseFile(object, "tests/datasets/missing.obj");
+  EXPECT_TRUE(object.vertexes.empty());
+  EXPECT_TRUE(object.lines.empty());
+}
+
+TEST(parsing, parallel_matches_serial) {
+  std::string buffer;
+  for (int i = 0; i < 2000; i++) {
+    buffer += "v " + std::to_string(i * 0.1) + " " + std::to_string(-i) +
+              " 1.25\n";
+    if (i > 2) {
+      buffer += "f " + std::to_string(i - 2) + "/1 " + std::to_string(i - 1) +
+                "// " + std::to_string(i) + "\n";
+    }
+  }
+
+  s21::ObjectParser parser;
+  s21::Object serial;
+  parser.parseBuffer(serial, buffer);
+  for (size_t chunks : {2, 3, 7, 64}) {
+    s21::Object parallel;
+    parser.parseBufferParallel(parallel, buffer, chunks);
+    ASSERT_EQ(serial.vertexes.size(), parallel.vertexes.size());
+    for (size_t i = 0; i < serial.vertexes.size(); i++) {
+      EXPECT_EQ(serial.vertexes[i].x, parallel.vertexes[i].x);
+      EXPECT_EQ(serial.vertexes[i].y, parallel.vertexes[i].y);
+      EXPECT_EQ(serial.vertexes[i].z, parallel.vertexes[i].z);
+    }
+    ASSERT_EQ(serial.lines.size(), parallel.lines.size());
+    for (size_t i = 0; i < serial.lines.size(); i++) {
+      EXPECT_EQ(serial.lines[i].indexes, parallel.lines[i].indexes);
+    }
+  }
+}
+
+TEST(parsing, parallel_file) {
+  s21::ObjectParser parser;
+  s21::Object object;
+  parser.parseFile(object, "tests/datasets/test1.obj",
+                   s21::ParseMode::kParallel);
+  EXPECT_EQ(object.vertexes.size(), 8);
+  EXPECT_EQ(object.lines.size(), 6);
+}
+
+TEST(parsing, tokenizer_face_indexes) {
+  s21::Tokenizer tokens("f 7 3/4 5//6 -1/-2/-3 +2/8/9 x");
+  EXPECT_EQ(tokens.readToken(), "f");
+  s21::FaceIndex index;
+  ASSERT_TRUE(tokens.readFaceIndex(index));
+  EXPECT_EQ(index.vertex, 7);
+  EXPECT_EQ(index.texture, 0);
+  ASSERT_TRUE(tokens.readFaceIndex(index));
+  EXPECT_EQ(index.texture, 4);
+  EXPECT_EQ(index.normal, 0);
+  ASSERT_TRUE(tokens.readFaceIndex(index));
+  EXPECT_EQ(index.texture, 0);
+  EXPECT_EQ(index.normal, 6);
+  ASSERT_TRUE(tokens.readFaceIndex(index));
+  EXPECT_EQ(index.vertex, -1);
+  EXPECT_EQ(index.texture, -2);
+  EXPECT_EQ(index.normal, -3);
+  ASSERT_TRUE(tokens.readFaceIndex(index));
+  EXPECT_EQ(index.vertex, 2);
+  EXPECT_FALSE(tokens.readFaceIndex(index));
+  EXPECT_TRUE(tokens.atEnd());
+}
+
+TEST(parsing, relative_indexes) {
+  std::string buffer;
+  for (int i = 0; i < 300; i++) {
+    buffer += "v " + std::to_string(i) + " 0 0\n";
+    if (i % 3 == 2) buffer += "f -3 -2/1 -1//1\n";
+  }
+
+  s21::ObjectParser parser;
+  s21::Object serial, parallel;
+  parser.parseBuffer(serial, buffer);
+  parser.parseBufferParallel(parallel, buffer, 9);
+  ASSERT_EQ(serial.lines.size(), 100);
+  EXPECT_EQ(serial.lines.at(0).indexes, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(serial.lines.at(99).indexes, std::vector<int>({297, 298, 299}));
+  ASSERT_EQ(parallel.lines.size(), serial.lines.size());
+  for (size_t i = 0; i < serial.lines.size(); i++) {
+    EXPECT_EQ(serial.lines[i].indexes, parallel.lines[i].indexes);
+  }
+}
+
+TEST(parsing, validate_faces) {
+  const char* buffer =
+      "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+      "f 1 2 3\nf 1 2 3 -4\nf 1 2 9\nf -5 1\nf 4 5\nf 3 -1\n"
+      "f 1 0 2 x 3 # 0 and x are counted\n";
+
+  s21::ObjectParser parser;
+  s21::Object repaired;
+  parser.parseBuffer(repaired, buffer);
+  EXPECT_EQ(parser.validation().invalid_indexes, 7);
+  EXPECT_EQ(parser.validation().repaired_faces, 3);
+  EXPECT_EQ(parser.validation().rejected_faces, 2);
+  ASSERT_EQ(repaired.lines.size(), 5);
+  EXPECT_EQ(repaired.lines.at(0).indexes, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(repaired.lines.at(1).indexes, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(repaired.lines.at(2).indexes, std::vector<int>({0, 1}));
+  EXPECT_EQ(repaired.lines.at(3).indexes, std::vector<int>({2, 2}));
+  EXPECT_EQ(repaired.lines.at(4).indexes, std::vector<int>({0, 1, 2}));
+
+  s21::Object rejected;
+  parser.setInvalidFaces(s21::InvalidFaces::kReject);
+  parser.parseBufferParallel(rejected, buffer, 3);
+  EXPECT_EQ(parser.validation().invalid_indexes, 7);
+  EXPECT_EQ(parser.validation().repaired_faces, 0);
+  EXPECT_EQ(parser.validation().rejected_faces, 5);
+  ASSERT_EQ(rejected.lines.size(), 2);
+  EXPECT_EQ(rejected.lines.at(0).indexes, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(rejected.lines.at(1).indexes, std::vector<int>({2, 2}));
+}
+
+TEST(parsing, open_polylines) {
+  const char* buffer =
+      "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+      "f 1 2 9\nl 1 2 3 4\nf 1 2 3\nl 4 3\n";
+
+  s21::ObjectParser parser;
+  s21::Object serial, parallel;
+  parser.parseBuffer(serial, buffer);
+  parser.parseBufferParallel(parallel, buffer, 4);
+  // Первый полигон исправлен, и флаги сдвинулись вместе с полигонами
+  ASSERT_EQ(serial.lines.size(), 4);
+  EXPECT_FALSE(serial.lines.at(0).open);
+  EXPECT_TRUE(serial.lines.at(1).open);
+  EXPECT_FALSE(serial.lines.at(2).open);
+  EXPECT_TRUE(serial.lines.at(3).open);
+  ASSERT_EQ(parallel.lines.size(), serial.lines.size());
+  for (size_t i = 0; i < serial.lines.size(); i++) {
+    EXPECT_EQ(parallel.lines.isOpen(i), serial.lines.isOpen(i));
+  }
+
+  // Ломаная 1-2-3-4 не дает ребра 4-1
+  serial.edges.build(serial.lines, serial.vertexes.size());
+  EXPECT_EQ(serial.edges.size(), 4);
+  for (size_t i = 0; i < serial.edges.size(); i++) {
+    EXPECT_FALSE(serial.edges[i].a == 0 && serial.edges[i].b == 3);
+  }
+}
+
+TEST(parsing, incremental_bounds) {
+  std::string buffer;
+  for (int i = 0; i < 500; i++) {
+    buffer += "v " + std::to_string(i - 200) + " " + std::to_string(i % 7) +
+              " -3e9\n";
+  }
+
+  s21::ObjectParser parser;
+  s21::Object serial, parallel;
+  s21::Bounds serial_bounds, parallel_bounds;
+  parser.setBounds(&serial_bounds);
+  parser.parseBuffer(serial, buffer);
+  parser.setBounds(&parallel_bounds);
+  parser.parseBufferParallel(parallel, buffer, 5);
+  parser.setBounds(nullptr);
+
+  s21::Bounds expected;
+  expected.extend(serial.vertexes);
+  for (const s21::Bounds& bounds : {serial_bounds, parallel_bounds}) {
+    EXPECT_EQ(bounds.min.x, -200);
+    EXPECT_EQ(bounds.max.x, 299);
+    EXPECT_EQ(bounds.max.y, 6);
+    EXPECT_EQ(bounds.min.z, expected.min.z);
+    EXPECT_EQ(bounds.max.z, expected.max.z);
+  }
+}
+
+TEST(parsing, directives) {
+  EXPECT_EQ(s21::classifyDirective("v"), s21::Directive::kVertex);
+  EXPECT_EQ(s21::classifyDirective("vn"), s21::Directive::kNormal);
+  EXPECT_EQ(s21::classifyDirective("vt"), s21::Directive::kTexture);
+  EXPECT_EQ(s21::classifyDirective("f"), s21::Directive::kFace);
+  EXPECT_EQ(s21::classifyDirective("l"), s21::Directive::kLine);
+  EXPECT_EQ(s21::classifyDirective("o"), s21::Directive::kObject);
+  EXPECT_EQ(s21::classifyDirective("g"), s21::Directive::kGroup);
+  EXPECT_EQ(s21::classifyDirective("usemtl"), s21::Directive::kMaterial);
+  EXPECT_EQ(s21::classifyDirective("mtllib"), s21::Directive::kUnknown);
+  EXPECT_EQ(s21::classifyDirective("#"), s21::Directive::kUnknown);
+
+  s21::ObjectParser parser;
+  s21::Object object;
+  parser.parseBuffer(object,
+                     "# cube\nmtllib cube.mtl\no cube\ng side\n"
+                     "v 0 0 0\nvt 0.5 0.5\nvn 0 0 1\nv\t1 0 0\nv 1 1 0\n"
+                     "usemtl red\nf 1/1/1 2/1/1 3/1/1\nl 1 3\n");
+  EXPECT_EQ(object.vertexes.size(), 3);
+  ASSERT_EQ(object.lines.size(), 2);
+  EXPECT_EQ(object.lines.at(0).indexes, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(object.lines.at(1).indexes, std::vector<int>({0, 2}));
+}
+
+TEST(parsing, face_array) {
+  s21::FaceArray faces;
+  faces.addIndex(1);
+  faces.addIndex(2);
+  faces.addIndex(3);
+  faces.closeFace();
+  faces.closeFace();
+  faces.push_back({4, 5});
+  ASSERT_EQ(faces.size(), 3);
+  EXPECT_EQ(faces.indexCount(), 5);
+  EXPECT_EQ(faces.at(0).indexes, std::vector<int>({1, 2, 3}));
+  EXPECT_TRUE(faces.at(1).indexes.empty());
+  EXPECT_THROW(faces.at(3), std::out_of_range);
+  EXPECT_THROW(faces.at(2).indexes.at(2), std::out_of_range);
+
+  s21::FaceArray merged;
+  merged.push_back({7});
+  merged.append(faces);
+  ASSERT_EQ(merged.size(), 4);
+  EXPECT_EQ(merged[3].indexes, std::vector<int>({4, 5}));
+  size_t count = 0;
+  for (s21::Face face : merged) count += face.indexes.size();
+  EXPECT_EQ(count, merged.indexCount());
+
+  merged.clear();
+  EXPECT_TRUE(merged.empty());
+  EXPECT_EQ(merged.indexCount(), 0);
+}
+
+TEST(parsing, edge_table) {
+  auto& controller = s21::Controller::getInstance();
+  controller.clearObject();
+  controller.parseFile("tests/datasets/test1.obj");
+  auto& edges = controller.getObject().edges;
+  ASSERT_EQ(edges.size(), 12);
+  for (const s21::Edge& edge : edges) {
+    EXPECT_LT(edge.a, edge.b);
+    EXPECT_LT(edge.b, 8u);
+  }
+  controller.clearObject();
+  EXPECT_TRUE(controller.getObject().edges.empty());
+}
+
+TEST(parsing, edge_table_shared_edges) {
+  const int n = 200;
+  s21::FaceArray faces;
+  std::set<std::pair<int, int>> expected;
+  for (int row = 0; row < n; row++) {
+    for (int col = 0; col < n; col++) {
+      int v = row * (n + 1) + col;
+      std::vector<int> quad = {v, v + 1, v + n + 2, v + n + 1};
+      faces.push_back(quad);
+      for (int k = 0; k < 4; k++) {
+        int a = quad[k], b = quad[(k + 1) % 4];
+        expected.emplace(std::min(a, b), std::max(a, b));
+      }
+    }
+  }
+  faces.push_back({0, 0});
+  faces.push_back({0, 1000000});
+  faces.push_back({-1, 0});
+
+  s21::EdgeTable edges;
+  edges.build(faces, (n + 1) * (n + 1));
+  EXPECT_EQ(edges.size(), 2u * n * (n + 1));
+  std::set<std::pair<int, int>> actual;
+  for (const s21::Edge& edge : edges) {
+    actual.emplace(static_cast<int>(edge.a), static_cast<int>(edge.b));
+  }
+  EXPECT_EQ(actual.size(), edges.size());
+  EXPECT_EQ(actual, expected);
+}
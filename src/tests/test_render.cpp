@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gif_lib.h>
+#include <zlib.h>
+
+#include "../render/gif_writer.hpp"
+#include "../render/png_writer.hpp"
+#include "../render/rasterizer.hpp"
+#include "../render/turntable.hpp"
+#include "tests.hpp"
+
+namespace {
+
+constexpr std::uint32_t kBlack = 0x000000FF;
+constexpr std::uint32_t kWhite = 0xFFFFFFFF;
+
+s21::Object makeSegment(s21::Point a, s21::Point b) {
+  s21::Object object;
+  object.vertexes.push_back(a);
+  object.vertexes.push_back(b);
+  object.lines.push_back({0, 1});
+  return object;
+}
+
+int countLit(const s21::Image& image) {
+  int lit = 0;
+  for (int y = 0; y < image.height(); y++) {
+    for (int x = 0; x < image.width(); x++) lit += image.rgba(x, y) != kBlack;
+  }
+  return lit;
+}
+
+std::uint32_t readBigEndian(const std::vector<std::uint8_t>& data,
+                            std::size_t at) {
+  return static_cast<std::uint32_t>(data[at]) << 24 | data[at + 1] << 16 |
+         data[at + 2] << 8 | data[at + 3];
+}
+
+}  // namespace
+
+TEST(render, single_edge) {
+  s21::Object object = makeSegment({-0.5, 0, 0}, {0.5, 0, 0});
+  s21::Image image(20, 20);
+  s21::Rasterizer rasterizer;
+  rasterizer.render(object, s21::Matrix4(), s21::RenderStyle(), image);
+
+  EXPECT_EQ(countLit(image), 10);
+  for (int x = 5; x < 15; x++) EXPECT_EQ(image.rgba(x, 10), kWhite);
+  EXPECT_EQ(image.rgba(4, 10), kBlack);
+  EXPECT_EQ(image.rgba(15, 10), kBlack);
+}
+
+TEST(render, line_width_and_dashes) {
+  s21::Object object = makeSegment({-1, 0, 0}, {1, 0, 0});
+  s21::RenderStyle style;
+  style.line_width = 3;
+  style.line_color = {1, 0, 0};
+  style.background = {0, 0, 1};
+  s21::Image image(64, 20);
+  s21::Rasterizer rasterizer;
+  rasterizer.render(object, s21::Matrix4(), style, image);
+  for (int y = 9; y <= 11; y++) EXPECT_EQ(image.rgba(30, y), 0xFF0000FFu);
+  EXPECT_EQ(image.rgba(30, 8), 0x0000FFFFu);
+  EXPECT_EQ(image.rgba(30, 12), 0x0000FFFFu);
+
+  // Пунктир отсчитывается от второй вершины, x = 64
+  style.dashed = true;
+  rasterizer.render(object, s21::Matrix4(), style, image);
+  EXPECT_EQ(image.rgba(63, 10), 0xFF0000FFu);
+  EXPECT_EQ(image.rgba(56, 10), 0xFF0000FFu);
+  EXPECT_EQ(image.rgba(55, 10), 0x0000FFFFu);
+  EXPECT_EQ(image.rgba(48, 10), 0x0000FFFFu);
+  EXPECT_EQ(image.rgba(47, 10), 0xFF0000FFu);
+}
+
+TEST(render, vertex_markers) {
+  s21::Object object;
+  object.vertexes.emplace_back(0, 0, 0);
+  object.vertexes.emplace_back(0, 0, 5);  // Вне пирамиды видимости
+  s21::RenderStyle style;
+  style.vertex_size = 5;
+  style.vertex_marker = s21::VertexMarker::kSquare;
+  s21::Image image(21, 21);
+  s21::Rasterizer rasterizer;
+  rasterizer.render(object, s21::Matrix4(), style, image);
+  EXPECT_EQ(countLit(image), 25);
+  EXPECT_EQ(image.rgba(8, 8), kWhite);
+  EXPECT_EQ(image.rgba(12, 12), kWhite);
+
+  style.vertex_marker = s21::VertexMarker::kRound;
+  rasterizer.render(object, s21::Matrix4(), style, image);
+  EXPECT_EQ(countLit(image), 21);
+  EXPECT_EQ(image.rgba(8, 8), kBlack);
+  EXPECT_EQ(image.rgba(10, 8), kWhite);
+}
+
+TEST(render, perspective_clipping) {
+  // Второй конец ребра позади камеры: рисуется только видимая часть
+  s21::Object object = makeSegment({0.5, 0, 0}, {0.5, 0, 5});
+  s21::RenderStyle style;
+  style.parallel_projection = false;
+  s21::Image image(40, 40);
+  s21::Rasterizer rasterizer;
+  rasterizer.render(object, s21::Matrix4(), style, image);
+  EXPECT_GT(countLit(image), 0);
+  // Начало ребра: x = 0.5 / 1.04 * 0.1 / 0.5 в NDC
+  double ndc = 0.5 / 1.04 * 0.2;
+  int x = static_cast<int>(std::ceil((ndc + 1) * 0.5 * 40 - 0.5));
+  EXPECT_EQ(image.rgba(x, 20), kWhite);
+  for (int y = 0; y < 40; y++) {
+    for (int col = 0; col < x; col++) EXPECT_EQ(image.rgba(col, y), kBlack);
+  }
+}
+
+TEST(render, tiles_match_single_tile) {
+  // Ребра пересекают границы плиток под разными углами и перекрываются
+  s21::Object object;
+  for (int i = 0; i < 60; i++) {
+    double angle = i * 0.37;
+    object.vertexes.emplace_back(0.9 * std::cos(angle), 0.8 * std::sin(angle),
+                                 0.3 * std::sin(3 * angle));
+  }
+  for (int i = 0; i < 60; i++) {
+    object.lines.push_back({i, (i * 7 + 3) % 60});
+  }
+  s21::RenderStyle style;
+  style.parallel_projection = false;
+  style.line_width = 3;
+  style.dashed = true;
+  style.vertex_marker = s21::VertexMarker::kRound;
+  style.vertex_size = 6;
+  s21::Matrix4 model = s21::Matrix4::fromMovement(s21::RotateY, 0.4);
+
+  s21::Image expected(150, 110);
+  s21::Rasterizer(4096).render(object, model, style, expected);
+  EXPECT_GT(countLit(expected), 500);
+  for (int tile_size : {7, 16, 64}) {
+    s21::Image image(150, 110);
+    s21::Rasterizer(tile_size).render(object, model, style, image);
+    EXPECT_TRUE(std::equal(expected.data(),
+                           expected.data() + 150 * 110 * 4, image.data()))
+        << "tile size " << tile_size;
+  }
+}
+
+TEST(render, turntable_frames) {
+  s21::Object object = makeSegment({-0.5, 0, 0}, {0.5, 0, 0});
+  s21::TurntableSettings settings;
+  settings.frames = 4;
+  settings.step = 90;
+  settings.width = 20;
+  settings.height = 20;
+  s21::Matrix4 model = s21::Matrix4::fromMovement(s21::MoveY, 0.5);
+  s21::Turntable turntable(object, model, settings);
+
+  std::vector<std::vector<std::uint8_t>> frames;
+  EXPECT_TRUE(turntable.run([&frames](int frame, const s21::Image& image) {
+    EXPECT_EQ(frame, static_cast<int>(frames.size()));
+    frames.emplace_back(image.data(), image.data() + 20 * 20 * 4);
+    return true;
+  }));
+  ASSERT_EQ(frames.size(), 4u);
+
+  // Кадр 0 - сама модель, на кадре 1 ребро смотрит вдоль оси z
+  s21::Image expected(20, 20);
+  s21::Rasterizer().render(object, model, settings.style, expected);
+  EXPECT_TRUE(std::equal(frames[0].begin(), frames[0].end(), expected.data()));
+  s21::Image image;
+  turntable.renderFrame(1, image);
+  EXPECT_EQ(image.width(), 20);
+  EXPECT_EQ(countLit(image), 0);
+  // Анимация рисует свою копию модели
+  object.vertexes.clear();
+  turntable.renderFrame(2, image);
+  EXPECT_EQ(countLit(image), 10);
+  EXPECT_EQ(image.rgba(5, 5), kWhite);
+
+  // Кадры не зависят от предыдущих запусков, sink может остановить запись
+  int calls = 0;
+  EXPECT_FALSE(turntable.run([&](int frame, const s21::Image& again) {
+    calls++;
+    EXPECT_TRUE(std::equal(frames[frame].begin(), frames[frame].end(),
+                           again.data()));
+    return frame < 1;
+  }));
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(render, gif_writer_streams_frames) {
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_viewer_test.gif").string();
+  s21::GifWriter writer;
+  ASSERT_TRUE(writer.open(path, 40, 30, 33));
+  std::uintmax_t size = std::filesystem::file_size(path);
+
+  // Кадр 0: три цвета, кадр 1: больше 256 цветов, нужна квантизация
+  s21::Image frame(40, 30);
+  frame.fill({0, 0, 1});
+  frame.set(3, 4, kWhite);
+  frame.set(39, 29, 0xFF0000FF);
+  s21::Image gradient(40, 30);
+  for (int y = 0; y < 30; y++) {
+    for (int x = 0; x < 40; x++) {
+      gradient.set(x, y, static_cast<std::uint32_t>(x * 6) << 24 |
+                             static_cast<std::uint32_t>(y * 8) << 16 | 0xFF);
+    }
+  }
+  for (const s21::Image* image : {&frame, &gradient, &frame}) {
+    ASSERT_TRUE(writer.addFrame(*image));
+    // Кадр записан в файл сразу, а не при закрытии
+    std::uintmax_t grown = std::filesystem::file_size(path);
+    EXPECT_GT(grown, size);
+    size = grown;
+  }
+  EXPECT_FALSE(writer.addFrame(s21::Image(20, 30)));
+  EXPECT_EQ(writer.frameCount(), 3);
+  EXPECT_TRUE(writer.close());
+  EXPECT_FALSE(writer.isOpen());
+  EXPECT_FALSE(writer.addFrame(frame));
+
+  int error = 0;
+  GifFileType* gif = DGifOpenFileName(path.c_str(), &error);
+  ASSERT_NE(gif, nullptr);
+  ASSERT_EQ(DGifSlurp(gif), GIF_OK);
+  EXPECT_EQ(gif->SWidth, 40);
+  EXPECT_EQ(gif->SHeight, 30);
+  ASSERT_EQ(gif->ImageCount, 3);
+  GraphicsControlBlock control;
+  ASSERT_EQ(DGifSavedExtensionToGCB(gif, 2, &control), GIF_OK);
+  EXPECT_EQ(control.DelayTime, 3);
+
+  auto color = [gif](int image, int x, int y) {
+    const SavedImage& saved = gif->SavedImages[image];
+    GifColorType c = saved.ImageDesc.ColorMap
+                         ->Colors[saved.RasterBits[y * 40 + x]];
+    return static_cast<std::uint32_t>(c.Red) << 24 | c.Green << 16 |
+           c.Blue << 8 | 0xFF;
+  };
+  for (int image : {0, 2}) {
+    EXPECT_EQ(color(image, 0, 0), 0x0000FFFFu);
+    EXPECT_EQ(color(image, 3, 4), kWhite);
+    EXPECT_EQ(color(image, 39, 29), 0xFF0000FFu);
+  }
+  for (auto [x, y] : {std::pair{0, 0}, std::pair{17, 11}, std::pair{39, 29}}) {
+    std::uint32_t c = color(1, x, y);
+    EXPECT_NEAR(static_cast<int>(c >> 24), x * 6, 32);
+    EXPECT_NEAR(static_cast<int>(c >> 16 & 0xFF), y * 8, 32);
+  }
+  DGifCloseFile(gif);
+  std::filesystem::remove(path);
+}
+
+TEST(render, png_deflate_chunks) {
+  // Шум почти не сжимается, поэтому данные не помещаются в один IDAT
+  s21::Image image(300, 200);
+  std::uint32_t seed = 1;
+  for (int y = 0; y < image.height(); y++) {
+    for (int x = 0; x < image.width(); x++) {
+      seed = seed * 1664525u + 1013904223u;
+      image.set(x, y, seed | 0xFF);
+    }
+  }
+  std::vector<std::uint8_t> png = s21::encodePng(image);
+  const std::uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A,
+                                    '\n'};
+  ASSERT_GT(png.size(), 8u);
+  EXPECT_TRUE(std::equal(std::begin(signature), std::end(signature),
+                         png.begin()));
+  EXPECT_EQ(readBigEndian(png, 16), 300u);
+  EXPECT_EQ(readBigEndian(png, 20), 200u);
+  EXPECT_EQ(png[24], 8);
+  EXPECT_EQ(png[25], 6);
+
+  std::vector<std::uint8_t> compressed;
+  std::vector<std::string> types;
+  std::size_t at = 8;
+  while (at + 12 <= png.size()) {
+    std::uint32_t length = readBigEndian(png, at);
+    ASSERT_LE(at + 12 + length, png.size());
+    const std::uint8_t* chunk = png.data() + at + 4;
+    EXPECT_EQ(crc32(0, chunk, length + 4), readBigEndian(png, at + 8 + length));
+    types.emplace_back(chunk, chunk + 4);
+    if (types.back() == "IDAT") {
+      EXPECT_LE(length, 64u * 1024);
+      compressed.insert(compressed.end(), chunk + 4, chunk + 4 + length);
+    }
+    at += 12 + length;
+  }
+  EXPECT_EQ(at, png.size());
+  ASSERT_GE(types.size(), 4u);
+  EXPECT_EQ(types.front(), "IHDR");
+  EXPECT_EQ(types.back(), "IEND");
+  EXPECT_GT(std::count(types.begin(), types.end(), "IDAT"), 1);
+
+  std::size_t row = 300 * 4 + 1;
+  std::vector<std::uint8_t> raw(row * 200);
+  uLongf size = raw.size();
+  ASSERT_EQ(uncompress(raw.data(), &size, compressed.data(), compressed.size()),
+            Z_OK);
+  ASSERT_EQ(size, raw.size());
+  EXPECT_EQ(raw[0], 0);
+  EXPECT_EQ(raw[row * 199], 0);
+  EXPECT_TRUE(std::equal(raw.begin() + row * 150 + 1,
+                         raw.begin() + row * 151, image.pixel(0, 150)));
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_viewer_test.png").string();
+  ASSERT_TRUE(s21::writePng(image, path));
+  EXPECT_EQ(std::filesystem::file_size(path), png.size());
+  std::filesystem::remove(path);
+  EXPECT_TRUE(s21::encodePng(s21::Image()).empty());
+}
@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <cmath>
 
 #include "../manipulation/manipulation.hpp"
 #include "../object/object.hpp"
+#include "../transformation/axis_transform.hpp"
+#include "../transformation/kernels.hpp"
 #include "tests.hpp"
 
 bool isEqualVectors(std::vector<s21::Point>& v1, std::vector<s21::Point>& v2) {
@@ -150,3 +153,356 @@ TEST(Scale, test) {
   model.TransformModel(v1, s21::SCALE, 0.5);
   EXPECT_TRUE(isEqualVectors(v1, v2));
 }
+
+TEST(VertexArray, layout) {
+  s21::VertexArray vertexes;
+  vertexes.emplace_back(1, 2, 3);
+  vertexes.push_back(s21::Point(4, 5, 6));
+  ASSERT_EQ(vertexes.size(), 2u);
+  EXPECT_EQ(vertexes.x()[1], 4);
+  EXPECT_EQ(vertexes.y()[0], 2);
+  EXPECT_EQ(vertexes.z()[1], 6);
+  EXPECT_EQ(vertexes.at(1).y, 5);
+  EXPECT_THROW(vertexes.at(2), std::out_of_range);
+
+  std::vector<float> buffer = vertexes.interleaved();
+  std::vector<float> expected = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(buffer, expected);
+  EXPECT_EQ(vertexes.interleaved(1),
+            std::vector<float>(expected.begin() + 3, expected.end()));
+
+  s21::VertexArray tail;
+  tail.emplace_back(7, 8, 9);
+  vertexes.append(tail);
+  std::vector<s21::Point> points = vertexes.toPoints();
+  std::vector<s21::Point> v2 = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+  EXPECT_TRUE(isEqualVectors(points, v2));
+}
+
+TEST(Normalization, vertex_array) {
+  s21::ManipulationFacade model;
+  s21::VertexArray vertexes;
+  vertexes.emplace_back(-1, 0, 2);
+  vertexes.emplace_back(3, 1, 4);
+  model.Normalization(vertexes);
+  std::vector<s21::Point> points = vertexes.toPoints();
+  std::vector<s21::Point> v2 = {{-0.5, -0.125, -0.25}, {0.5, 0.125, 0.25}};
+  EXPECT_TRUE(isEqualVectors(points, v2));
+}
+
+TEST(Normalization, large_coordinates) {
+  s21::ManipulationFacade model;
+  s21::ExecutionPolicy policy;
+  policy.threshold = 1;
+  policy.chunk_size = 5;
+  model.setExecutionPolicy(policy);
+  s21::VertexArray vertexes, known;
+  for (int i = 0; i < 23; i++) vertexes.emplace_back(3e9 + i, -2e9, i * 1e8);
+  known = vertexes;
+  s21::Bounds bounds;
+  bounds.extend(known);
+  model.Normalization(vertexes);
+  model.Normalization(known, bounds);
+  EXPECT_NEAR(vertexes.at(0).z, -0.5, 1e-6);
+  EXPECT_NEAR(vertexes.at(22).z, 0.5, 1e-6);
+  EXPECT_NEAR(vertexes.at(0).y, 0, 1e-6);
+  for (size_t i = 0; i < vertexes.size(); i++) {
+    EXPECT_EQ(vertexes[i].x, known[i].x);
+    EXPECT_EQ(vertexes[i].z, known[i].z);
+  }
+}
+
+TEST(Matrix4, matches_strategies) {
+  s21::ManipulationFacade model;
+  std::vector<s21::Point> points = {
+      {1, 1, 1}, {3.2, 3.4, 4.3}, {3.2, 0, 0}, {7.2, -43, 4}};
+  std::vector<std::pair<s21::Movement, double>> moves = {
+      {s21::MoveX, 1},    {s21::RotateX, 30}, {s21::MoveY, -2},
+      {s21::RotateY, 45}, {s21::SCALE, 0.5},  {s21::RotateZ, -60},
+      {s21::MoveZ, 0.25}};
+  s21::VertexArray pristine(points), expected(points), actual;
+  s21::Matrix4 matrix;
+  for (auto [move, value] : moves) {
+    model.TransformModel(expected, move, value);
+    matrix = s21::Matrix4::fromMovement(move, value) * matrix;
+  }
+  matrix.apply(pristine, actual);
+  std::vector<s21::Point> v1 = actual.toPoints(), v2 = expected.toPoints();
+  EXPECT_TRUE(isEqualVectors(v1, v2));
+  s21::Point p = matrix.apply(points[1]);
+  EXPECT_NEAR(p.x, v2[1].x, kScalarTolerance);
+  EXPECT_NEAR(p.y, v2[1].y, kScalarTolerance);
+  EXPECT_NEAR(p.z, v2[1].z, kScalarTolerance);
+}
+
+TEST(Matrix4, controller_deferred) {
+  auto& controller = s21::Controller::getInstance();
+  controller.clearObject();
+  controller.getObject().vertexes.emplace_back(1, 2, 3);
+  controller.getObject().vertexes.emplace_back(-1, 0, 2);
+  controller.setTransformMode(s21::TransformMode::kDeferred);
+  for (int i = 0; i < 1000; i++) {
+    controller.TransformModel(s21::RotateX, 7);
+    controller.TransformModel(s21::RotateX, -7);
+  }
+  controller.TransformModel(s21::MoveX, 2);
+  EXPECT_EQ(controller.getObject().vertexes.at(0).x, 1);
+  s21::Point p = controller.transformedVertexes().at(0);
+  EXPECT_NEAR(p.x, 3, 1e-9);
+  EXPECT_NEAR(p.y, 2, 1e-9);
+  EXPECT_NEAR(p.z, 3, 1e-9);
+
+  // Нормализация меняет вершины, и кэш преобразованных вершин сбрасывается
+  controller.Normalization();
+  s21::Point normalized = controller.getObject().vertexes.at(0);
+  p = controller.transformedVertexes().at(0);
+  EXPECT_NEAR(p.x, normalized.x + 2, 1e-6);
+  EXPECT_NEAR(p.y, normalized.y, 1e-6);
+  EXPECT_NEAR(p.z, normalized.z, 1e-6);
+
+  controller.setTransformMode(s21::TransformMode::kImmediate);
+  EXPECT_TRUE(controller.modelMatrix().isIdentity());
+  EXPECT_NEAR(controller.getObject().vertexes.at(0).x, normalized.x + 2, 1e-6);
+  controller.clearObject();
+}
+
+TEST(Matrix4, projections) {
+  s21::Matrix4 ortho = s21::Matrix4::orthographic(-2, 2, -1, 1, 0, 10);
+  s21::Point p = ortho.apply(s21::Point(2, -1, -10));
+  EXPECT_NEAR(p.x, 1, 1e-12);
+  EXPECT_NEAR(p.y, -1, 1e-12);
+  EXPECT_NEAR(p.z, 1, 1e-12);
+
+  s21::Matrix4 frustum = s21::Matrix4::frustum(-0.5, 0.5, -0.5, 0.5, 0.1, 100);
+  const double corner[4] = {0.5, 0.5, -0.1, 1};
+  double clip[4] = {};
+  for (int row = 0; row < 4; row++) {
+    for (int k = 0; k < 4; k++) clip[row] += frustum(row, k) * corner[k];
+  }
+  EXPECT_NEAR(clip[0] / clip[3], 1, 1e-12);
+  EXPECT_NEAR(clip[1] / clip[3], 1, 1e-12);
+  EXPECT_NEAR(clip[2] / clip[3], -1, 1e-12);
+}
+
+TEST(Matrix4, controller_revision) {
+  auto& controller = s21::Controller::getInstance();
+  controller.clearObject();
+  controller.parseFile("tests/datasets/test1.obj");
+  std::uint64_t loaded = controller.revision();
+
+  controller.setTransformMode(s21::TransformMode::kDeferred);
+  controller.TransformModel(s21::RotateX, 30);
+  controller.TransformBatch({{s21::MoveY, 1}, {s21::SCALE, 2}});
+  EXPECT_EQ(controller.revision(), loaded);
+
+  controller.setTransformMode(s21::TransformMode::kImmediate);
+  std::uint64_t applied = controller.revision();
+  EXPECT_GT(applied, loaded);
+  controller.TransformModel(s21::MoveX, 1);
+  EXPECT_GT(controller.revision(), applied);
+  controller.clearObject();
+}
+
+TEST(Matrix4, batch_matches_sequential) {
+  std::vector<s21::TransformOperation> operations = {
+      {s21::RotateY, 30}, {s21::MoveX, 1.5}, {s21::SCALE, 2},
+      {s21::RotateX, -45}, {s21::MoveZ, -0.5}};
+  s21::VertexArray sequential, batch;
+  for (int i = 0; i < 50; i++) {
+    sequential.emplace_back(i * 0.1, 1 - i * 0.05, i % 7);
+  }
+  batch = sequential;
+
+  s21::ManipulationFacade facade;
+  s21::ExecutionPolicy policy;
+  policy.threshold = 1;
+  policy.chunk_size = 8;
+  facade.setExecutionPolicy(policy);
+  for (const s21::TransformOperation& operation : operations) {
+    facade.TransformModel(sequential, operation.move, operation.value);
+  }
+  facade.TransformBatch(batch, operations);
+  for (size_t i = 0; i < batch.size(); i++) {
+    EXPECT_NEAR(batch[i].x, sequential[i].x, 1e-5);
+    EXPECT_NEAR(batch[i].y, sequential[i].y, 1e-5);
+    EXPECT_NEAR(batch[i].z, sequential[i].z, 1e-5);
+  }
+
+  auto& controller = s21::Controller::getInstance();
+  controller.clearObject();
+  controller.getObject().vertexes.emplace_back(1, 2, 3);
+  controller.setTransformMode(s21::TransformMode::kDeferred);
+  controller.TransformBatch(operations);
+  s21::Point p = controller.transformedVertexes().at(0);
+  s21::Point expected = s21::Matrix4::fromOperations(operations).apply(
+      s21::Point(1, 2, 3));
+  EXPECT_NEAR(p.x, expected.x, 1e-5);
+  EXPECT_NEAR(p.y, expected.y, 1e-5);
+  EXPECT_NEAR(p.z, expected.z, 1e-5);
+  controller.setTransformMode(s21::TransformMode::kImmediate);
+  controller.clearObject();
+}
+
+TEST(AxisTransform, matches_strategies) {
+  s21::VertexArray source;
+  for (int i = 0; i < 21; i++) source.emplace_back(i - 10, i * 0.5, 3 - i);
+  s21::Move move;
+  s21::Rotate rotate;
+  s21::Scale scale;
+  s21::ObjectTransformer transformer;
+  transformer.set_policy(s21::ExecutionPolicy{});
+  for (s21::Movement m : {s21::MoveX, s21::MoveY, s21::MoveZ, s21::RotateX,
+                          s21::RotateY, s21::RotateZ, s21::SCALE}) {
+    s21::VertexArray expected = source, actual = source;
+    if (m <= s21::MoveZ) {
+      transformer.set_strategy(&move);
+    } else if (m <= s21::RotateZ) {
+      transformer.set_strategy(&rotate);
+    } else {
+      transformer.set_strategy(&scale);
+    }
+    transformer.TransformModel(expected, m, 1.25);
+    s21::TransformVertexes(actual, m, 1.25, s21::ExecutionPolicy{});
+    for (size_t i = 0; i < source.size(); i++) {
+      EXPECT_EQ(actual[i].x, expected[i].x);
+      EXPECT_EQ(actual[i].y, expected[i].y);
+      EXPECT_EQ(actual[i].z, expected[i].z);
+    }
+  }
+  s21::VertexArray rotated = source;
+  s21::AxisTransform<s21::Rotation, s21::Axis::kZ>::Transform(rotated.range(),
+                                                              90);
+  EXPECT_NEAR(rotated[0].x, 0, 1e-6);
+  EXPECT_NEAR(rotated[0].y, -10, 1e-6);
+  EXPECT_EQ(rotated[0].z, 3);
+}
+
+TEST(Kernels, levels_match_scalar) {
+  const size_t count = 37;
+  std::vector<s21::Scalar> u0(count), v0(count);
+  for (size_t i = 0; i < count; i++) {
+    u0[i] = static_cast<s21::Scalar>(i * 0.25 - 3);
+    v0[i] = static_cast<s21::Scalar>(7 - i * 0.5);
+  }
+  const s21::TransformKernels& scalar =
+      s21::kernelsFor(s21::SimdLevel::kScalar);
+  std::vector<s21::Scalar> su = u0, sv = v0;
+  scalar.translate(su.data(), count, 1.5);
+  scalar.scale(sv.data(), count, -2);
+  scalar.rotate(su.data(), sv.data(), count, 0.6, 0.8);
+  scalar.affine(su.data(), count, 0.5, -1);
+  s21::Scalar slo = 0, shi = 0;
+  scalar.bounds(sv.data(), count, &slo, &shi);
+  const s21::Scalar matrix[16] = {1, 2, 3, 4, -1, 0.5, 2, 0,
+                                  0, 0, -3, 1, 0.25, 0, 1, 2};
+  std::vector<s21::Scalar> sclip(count * 4);
+  s21::Scalar* const srows[4] = {&sclip[0], &sclip[count], &sclip[2 * count],
+                                 &sclip[3 * count]};
+  scalar.project(u0.data(), v0.data(), su.data(), count, matrix, srows);
+  EXPECT_NEAR(sclip[3 * count + 1], 4 * u0[1] + su[1] + 2, 1e-9);
+
+  for (s21::SimdLevel level :
+       {s21::SimdLevel::kSse2, s21::SimdLevel::kAvx2,
+        s21::SimdLevel::kAvx512}) {
+    const s21::TransformKernels& kernels = s21::kernelsFor(level);
+    if (level <= s21::detectSimdLevel()) {
+      EXPECT_EQ(kernels.level, level);
+    }
+    std::vector<s21::Scalar> u = u0, v = v0;
+    kernels.translate(u.data(), count, 1.5);
+    kernels.scale(v.data(), count, -2);
+    kernels.rotate(u.data(), v.data(), count, 0.6, 0.8);
+    kernels.affine(u.data(), count, 0.5, -1);
+    s21::Scalar lo = 0, hi = 0;
+    kernels.bounds(v.data(), count, &lo, &hi);
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_NEAR(u[i], su[i], 1e-5);
+      EXPECT_NEAR(v[i], sv[i], 1e-5);
+    }
+    EXPECT_EQ(lo, slo);
+    EXPECT_EQ(hi, shi);
+
+    std::vector<s21::Scalar> clip(count * 4);
+    s21::Scalar* const rows[4] = {&clip[0], &clip[count], &clip[2 * count],
+                                  &clip[3 * count]};
+    kernels.project(u0.data(), v0.data(), su.data(), count, matrix, rows);
+    for (size_t i = 0; i < clip.size(); i++) {
+      EXPECT_NEAR(clip[i], sclip[i], 1e-5);
+    }
+    EXPECT_EQ(lo, *std::min_element(v.begin(), v.end()));
+    EXPECT_EQ(hi, *std::max_element(v.begin(), v.end()));
+  }
+}
+
+TEST(Kernels, project_independent_of_chunks) {
+  // Больше одной части растеризатора (1 << 14 вершин) и не кратно ширине
+  // регистра, чтобы границы частей попадали внутрь регистров
+  const size_t count = (1 << 15) + 13;
+  std::vector<s21::Scalar> x(count), y(count), z(count);
+  for (size_t i = 0; i < count; i++) {
+    x[i] = static_cast<s21::Scalar>(std::sin(i * 0.37));
+    y[i] = static_cast<s21::Scalar>(std::cos(i * 0.11) * 3);
+    z[i] = static_cast<s21::Scalar>(std::sin(i * 0.05) - 0.3);
+  }
+  const s21::Scalar matrix[16] = {0.7,  0.1, -0.3, 0.01, -0.2, 1.3, 0.4, 0.02,
+                                  0.33, 0.9, -1.1, 0.3,  0.17, -2.5, 0.6, 1.9};
+  for (s21::SimdLevel level :
+       {s21::SimdLevel::kScalar, s21::SimdLevel::kSse2, s21::SimdLevel::kAvx2,
+        s21::SimdLevel::kAvx512}) {
+    if (level > s21::detectSimdLevel()) continue;
+    const s21::TransformKernels& kernels = s21::kernelsFor(level);
+    std::vector<s21::Scalar> whole(count * 4);
+    s21::Scalar* const rows[4] = {&whole[0], &whole[count], &whole[2 * count],
+                                  &whole[3 * count]};
+    kernels.project(x.data(), y.data(), z.data(), count, matrix, rows);
+    for (size_t chunks : {2, 3, 7, 31}) {
+      std::vector<s21::Scalar> split(count * 4);
+      for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t first = count * chunk / chunks;
+        size_t last = count * (chunk + 1) / chunks;
+        s21::Scalar* const parts[4] = {
+            &split[first], &split[count + first], &split[2 * count + first],
+            &split[3 * count + first]};
+        kernels.project(x.data() + first, y.data() + first, z.data() + first,
+                        last - first, matrix, parts);
+      }
+      size_t mismatches = 0;
+      for (size_t i = 0; i < whole.size(); i++) {
+        mismatches += whole[i] != split[i];
+      }
+      EXPECT_EQ(mismatches, 0u) << "chunks " << chunks;
+    }
+  }
+}
+
+TEST(ExecutionPolicy, parallel_matches_serial) {
+  s21::VertexArray serial, parallel;
+  for (int i = 0; i < 10007; i++) {
+    serial.emplace_back(i * 0.001, std::sin(i * 0.1), -i % 13);
+  }
+  parallel = serial;
+
+  s21::ExecutionPolicy policy;
+  policy.parallel = false;
+  s21::ManipulationFacade serial_model;
+  serial_model.setExecutionPolicy(policy);
+  policy.parallel = true;
+  policy.threshold = 0;
+  policy.chunk_size = 97;
+  s21::ManipulationFacade parallel_model;
+  parallel_model.setExecutionPolicy(policy);
+  EXPECT_EQ(s21::rangeCount(policy, parallel.size()), 104u);
+
+  for (s21::ManipulationFacade* model : {&serial_model, &parallel_model}) {
+    s21::VertexArray& vertexes = model == &serial_model ? serial : parallel;
+    model->Normalization(vertexes);
+    model->TransformModel(vertexes, s21::RotateX, 33);
+    model->TransformModel(vertexes, s21::MoveY, -0.25);
+    model->TransformModel(vertexes, s21::SCALE, 1.5);
+  }
+  for (size_t i = 0; i < serial.size(); i++) {
+    EXPECT_EQ(serial.x()[i], parallel.x()[i]);
+    EXPECT_EQ(serial.y()[i], parallel.y()[i]);
+    EXPECT_EQ(serial.z()[i], parallel.z()[i]);
+  }
+}
@@ -4,5 +4,16 @@
 #include <gtest/gtest.h>
 
 #include "../controller/controller.h"
+#include "../parser/tokenizer.hpp"
+
+// Координаты хранятся в s21::Scalar, поэтому точность сравнения зависит
+// от сборки с S21_FLOAT32_VERTICES
+#ifdef S21_FLOAT32_VERTICES
+#define EXPECT_SCALAR_EQ(a, b) EXPECT_FLOAT_EQ(a, b)
+constexpr double kScalarTolerance = 1e-5;
+#else
+#define EXPECT_SCALAR_EQ(a, b) EXPECT_DOUBLE_EQ(a, b)
+constexpr double kScalarTolerance = 1e-9;
+#endif
 
 #endif  // CPP4_3DVIEWER_V_2_0_TESTS_HPP_
@@ -0,0 +1,33 @@
+#include "axis_transform.hpp"
+
+/************************************************************
+ * @file axis_transform.cpp
+ * @brief Преобразования с осью и операцией на этапе компиляции
+ ************************************************************/
+
+void s21::TransformVertexes(VertexArray& vertexes, Movement move,
+                            double value, const ExecutionPolicy& policy) {
+  switch (move) {
+    case MoveX:
+      AxisTransform<Translation, Axis::kX>::Transform(vertexes, value, policy);
+      break;
+    case MoveY:
+      AxisTransform<Translation, Axis::kY>::Transform(vertexes, value, policy);
+      break;
+    case MoveZ:
+      AxisTransform<Translation, Axis::kZ>::Transform(vertexes, value, policy);
+      break;
+    case RotateX:
+      AxisTransform<Rotation, Axis::kX>::Transform(vertexes, value, policy);
+      break;
+    case RotateY:
+      AxisTransform<Rotation, Axis::kY>::Transform(vertexes, value, policy);
+      break;
+    case RotateZ:
+      AxisTransform<Rotation, Axis::kZ>::Transform(vertexes, value, policy);
+      break;
+    case SCALE:
+      AxisTransform<Scaling, Axis::kAll>::Transform(vertexes, value, policy);
+      break;
+  }
+}
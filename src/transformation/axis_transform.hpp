@@ -0,0 +1,161 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_AXIS_TRANSFORM_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_AXIS_TRANSFORM_HPP_
+
+/************************************************************
+ * @file axis_transform.hpp
+ * @brief Преобразования с осью и операцией на этапе компиляции
+ *
+ * AxisTransform<Op, A> выбирает массив координат и ядро без виртуальных
+ *вызовов и switch: все решается при компиляции, а во время выполнения
+ *остается только цикл ядра. Перечисление Movement разбирается один раз
+ *за вызов в TransformVertexes.
+ ************************************************************/
+
+#include <cmath>
+
+#include "../object/object.hpp"
+#include "execution.hpp"
+#include "kernels.hpp"
+#include "transformation.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Ось преобразования
+ * @details kAll - все оси сразу, используется для масштабирования
+ ************************************************************/
+enum class Axis { kX, kY, kZ, kAll };
+
+/************************************************************
+ * @brief Массив координат участка по оси A
+ ************************************************************/
+template <Axis A>
+Scalar* axisOf(VertexRange vertexes) {
+  static_assert(A != Axis::kAll, "axisOf requires a single axis");
+  if constexpr (A == Axis::kX) {
+    return vertexes.x;
+  } else if constexpr (A == Axis::kY) {
+    return vertexes.y;
+  } else {
+    return vertexes.z;
+  }
+}
+
+/************************************************************
+ * @brief Перемещение вдоль оси
+ ************************************************************/
+struct Translation {
+  using Args = Scalar;
+
+  static Args prepare(double step) { return static_cast<Scalar>(step); }
+
+  template <Axis A>
+  static void apply(const TransformKernels& kernels, VertexRange vertexes,
+                    Args step) {
+    kernels.translate(axisOf<A>(vertexes), vertexes.size, step);
+  }
+};
+
+/************************************************************
+ * @brief Поворот вокруг оси, угол в градусах
+ *
+ * Поворот вокруг X вращает плоскость (y, z), вокруг Y - (z, x), вокруг
+ *Z - (x, y), как в стратегии Rotate.
+ ************************************************************/
+struct Rotation {
+  struct Args {
+    Scalar cos, sin;
+  };
+
+  static Args prepare(double angle) {
+    angle = angle * M_PI / 180;
+    return Args{static_cast<Scalar>(std::cos(angle)),
+                static_cast<Scalar>(std::sin(angle))};
+  }
+
+  template <Axis A>
+  static void apply(const TransformKernels& kernels, VertexRange vertexes,
+                    Args args) {
+    static_assert(A != Axis::kAll, "rotation requires a single axis");
+    constexpr Axis kU = A == Axis::kX   ? Axis::kY
+                        : A == Axis::kY ? Axis::kZ
+                                        : Axis::kX;
+    constexpr Axis kV = A == Axis::kX   ? Axis::kZ
+                        : A == Axis::kY ? Axis::kX
+                                        : Axis::kY;
+    kernels.rotate(axisOf<kU>(vertexes), axisOf<kV>(vertexes), vertexes.size,
+                   args.cos, args.sin);
+  }
+};
+
+/************************************************************
+ * @brief Масштабирование по оси или по всем осям (Axis::kAll)
+ ************************************************************/
+struct Scaling {
+  using Args = Scalar;
+
+  static Args prepare(double factor) { return static_cast<Scalar>(factor); }
+
+  template <Axis A>
+  static void apply(const TransformKernels& kernels, VertexRange vertexes,
+                    Args factor) {
+    if constexpr (A == Axis::kAll) {
+      apply<Axis::kX>(kernels, vertexes, factor);
+      apply<Axis::kY>(kernels, vertexes, factor);
+      apply<Axis::kZ>(kernels, vertexes, factor);
+    } else {
+      kernels.scale(axisOf<A>(vertexes), vertexes.size, factor);
+    }
+  }
+};
+
+/************************************************************
+ * @brief Преобразование с операцией Op и осью A
+ *
+ * Аргументы ядра (шаг, синус и косинус, коэффициент) и таблица ядер
+ *вычисляются один раз на вызов, а не на каждую часть модели.
+ ************************************************************/
+template <typename Op, Axis A>
+struct AxisTransform {
+  /************************************************************
+   * @brief Метод преобразования участка вершин
+   * @param vertexes Участок вершин
+   * @param value Шаг, угол в градусах или коэффициент
+   ************************************************************/
+  static void Transform(VertexRange vertexes, double value) {
+    Op::template apply<A>(transformKernels(), vertexes, Op::prepare(value));
+  }
+
+  /************************************************************
+   * @brief Метод преобразования модели
+   * @param vertexes Вершины модели
+   * @param value Шаг, угол в градусах или коэффициент
+   * @param policy Политика выполнения
+   ************************************************************/
+  static void Transform(VertexArray& vertexes, double value,
+                        const ExecutionPolicy& policy) {
+    const TransformKernels& kernels = transformKernels();
+    const typename Op::Args args = Op::prepare(value);
+    forEachRange(policy, vertexes.size(),
+                 [&](std::size_t, std::size_t first, std::size_t last) {
+                   Op::template apply<A>(kernels, vertexes.range(first, last),
+                                         args);
+                 });
+  }
+};
+
+/************************************************************
+ * @brief Функция преобразования модели по названию преобразования
+ *
+ * Выбирает специализацию AxisTransform один раз за вызов.
+ * @param vertexes Вершины модели
+ * @param move Название преобразования
+ * @param value Шаг, угол в градусах или коэффициент
+ * @param policy Политика выполнения
+ ************************************************************/
+void TransformVertexes(VertexArray& vertexes, Movement move, double value,
+                       const ExecutionPolicy& policy);
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_AXIS_TRANSFORM_HPP_
@@ -0,0 +1,32 @@
+#include "execution.hpp"
+
+#include <algorithm>
+
+#include "../concurrency/thread_pool.hpp"
+
+/************************************************************
+ * @file execution.cpp
+ * @brief Параллельное выполнение преобразований над вершинами
+ ************************************************************/
+
+std::size_t s21::rangeCount(const ExecutionPolicy& policy, std::size_t count) {
+  if (!policy.parallel || count < policy.threshold || count == 0) return 1;
+  std::size_t chunk = std::max<std::size_t>(policy.chunk_size, 1);
+  return (count + chunk - 1) / chunk;
+}
+
+void s21::forEachRange(
+    const ExecutionPolicy& policy, std::size_t count,
+    const std::function<void(std::size_t index, std::size_t first,
+                             std::size_t last)>& body) {
+  std::size_t ranges = rangeCount(policy, count);
+  if (ranges == 1) {
+    body(0, 0, count);
+    return;
+  }
+  std::size_t chunk = std::max<std::size_t>(policy.chunk_size, 1);
+  ThreadPool::shared().parallelFor(ranges, [&](std::size_t index) {
+    std::size_t first = index * chunk;
+    body(index, first, std::min(first + chunk, count));
+  });
+}
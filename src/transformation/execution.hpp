@@ -0,0 +1,64 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_EXECUTION_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_EXECUTION_HPP_
+
+/************************************************************
+ * @file execution.hpp
+ * @brief Параллельное выполнение преобразований над вершинами
+ ************************************************************/
+
+#include <cstddef>
+#include <functional>
+
+namespace s21 {
+
+/************************************************************
+ * @brief Политика выполнения преобразований
+ *
+ * Вершины делятся на части одинакового размера chunk_size, которые
+ *обрабатываются в общем пуле потоков. Границы частей не зависят от
+ *количества потоков, поэтому результат всегда одинаковый.
+ ************************************************************/
+struct ExecutionPolicy {
+  /************************************************************
+   * @brief Разрешено ли параллельное выполнение
+   ************************************************************/
+  bool parallel = true;
+
+  /************************************************************
+   * @brief Меньше стольких вершин модель обрабатывается в текущем потоке
+   ************************************************************/
+  std::size_t threshold = 1 << 18;
+
+  /************************************************************
+   * @brief Количество вершин в одной части
+   ************************************************************/
+  std::size_t chunk_size = 1 << 16;
+};
+
+/************************************************************
+ * @brief Функция для получения количества частей
+ * @param policy Политика выполнения
+ * @param count Количество вершин
+ * @return 1, если вершины обрабатываются в текущем потоке
+ ************************************************************/
+std::size_t rangeCount(const ExecutionPolicy& policy, std::size_t count);
+
+/************************************************************
+ * @brief Функция для обработки вершин [0, count) по частям
+ *
+ * body(index, first, last) вызывается для каждой части с номером index из
+ *[0, rangeCount(policy, count)). Возвращает управление после обработки
+ *всех частей.
+ * @param policy Политика выполнения
+ * @param count Количество вершин
+ * @param body Обработка одной части
+ * @return void
+ ************************************************************/
+void forEachRange(
+    const ExecutionPolicy& policy, std::size_t count,
+    const std::function<void(std::size_t index, std::size_t first,
+                             std::size_t last)>& body);
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_EXECUTION_HPP_
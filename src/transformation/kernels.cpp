@@ -0,0 +1,88 @@
+#include "kernels.hpp"
+
+/************************************************************
+ * @file kernels.cpp
+ * @brief Скалярные ядра и выбор набора инструкций
+ ************************************************************/
+
+namespace {
+
+void translateScalar(s21::Scalar* axis, std::size_t count,
+                     s21::Scalar delta) {
+  for (std::size_t i = 0; i < count; i++) axis[i] += delta;
+}
+
+void scaleScalar(s21::Scalar* axis, std::size_t count, s21::Scalar factor) {
+  for (std::size_t i = 0; i < count; i++) axis[i] *= factor;
+}
+
+void rotateScalar(s21::Scalar* u, s21::Scalar* v, std::size_t count,
+                  s21::Scalar cos, s21::Scalar sin) {
+  for (std::size_t i = 0; i < count; i++) {
+    s21::Scalar a = u[i];
+    u[i] = a * cos - v[i] * sin;
+    v[i] = a * sin + v[i] * cos;
+  }
+}
+
+void affineScalar(s21::Scalar* axis, std::size_t count, s21::Scalar factor,
+                  s21::Scalar offset) {
+  for (std::size_t i = 0; i < count; i++) axis[i] = axis[i] * factor + offset;
+}
+
+void boundsScalar(const s21::Scalar* axis, std::size_t count,
+                  s21::Scalar* lo, s21::Scalar* hi) {
+  for (std::size_t i = 0; i < count; i++) {
+    if (axis[i] < *lo) *lo = axis[i];
+    if (axis[i] > *hi) *hi = axis[i];
+  }
+}
+
+void projectScalar(const s21::Scalar* x, const s21::Scalar* y,
+                   const s21::Scalar* z, std::size_t count,
+                   const s21::Scalar* m, s21::Scalar* const* clip) {
+  for (int r = 0; r < 4; r++) {
+    for (std::size_t i = 0; i < count; i++) {
+      clip[r][i] =
+          (x[i] * m[r] + y[i] * m[4 + r]) + (z[i] * m[8 + r] + m[12 + r]);
+    }
+  }
+}
+
+const s21::TransformKernels kScalarKernels{
+    s21::SimdLevel::kScalar, translateScalar, scaleScalar, rotateScalar,
+    affineScalar,            boundsScalar,    projectScalar};
+
+}  // namespace
+
+s21::SimdLevel s21::detectSimdLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2")) return SimdLevel::kAvx2;
+  if (__builtin_cpu_supports("sse2")) return SimdLevel::kSse2;
+#endif
+  return SimdLevel::kScalar;
+}
+
+const s21::TransformKernels& s21::kernelsFor(SimdLevel level) {
+  if (level > detectSimdLevel()) return kScalarKernels;
+#if defined(__x86_64__) || defined(__i386__)
+  switch (level) {
+    case SimdLevel::kSse2:
+      return sse2Kernels();
+    case SimdLevel::kAvx2:
+      return avx2Kernels();
+    case SimdLevel::kAvx512:
+      return avx512Kernels();
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  return kScalarKernels;
+}
+
+const s21::TransformKernels& s21::transformKernels() {
+  static const TransformKernels& kernels = kernelsFor(detectSimdLevel());
+  return kernels;
+}
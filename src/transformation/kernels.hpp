@@ -0,0 +1,106 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_HPP_
+
+/************************************************************
+ * @file kernels.hpp
+ * @brief Векторизованные ядра афинных преобразований
+ *
+ * Ядра работают с одним или двумя массивами координат VertexArray. Для
+ *каждого набора инструкций (SSE2, AVX2, AVX-512) ядра собираются в
+ *отдельной единице трансляции, а нужный набор выбирается при первом
+ *обращении по возможностям процессора.
+ ************************************************************/
+
+#include <cstddef>
+
+#include "../object/object.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Набор инструкций, под который собраны ядра
+ ************************************************************/
+enum class SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+/************************************************************
+ * @brief Таблица ядер одного набора инструкций
+ ************************************************************/
+struct TransformKernels {
+  /************************************************************
+   * @brief Набор инструкций
+   ************************************************************/
+  SimdLevel level;
+
+  /************************************************************
+   * @brief axis[i] += delta
+   ************************************************************/
+  void (*translate)(Scalar* axis, std::size_t count, Scalar delta);
+
+  /************************************************************
+   * @brief axis[i] *= factor
+   ************************************************************/
+  void (*scale)(Scalar* axis, std::size_t count, Scalar factor);
+
+  /************************************************************
+   * @brief Поворот в плоскости (u, v)
+   * @details u' = u * cos - v * sin, v' = u * sin + v * cos
+   ************************************************************/
+  void (*rotate)(Scalar* u, Scalar* v, std::size_t count, Scalar cos,
+                 Scalar sin);
+
+  /************************************************************
+   * @brief axis[i] = axis[i] * factor + offset
+   ************************************************************/
+  void (*affine)(Scalar* axis, std::size_t count, Scalar factor,
+                 Scalar offset);
+
+  /************************************************************
+   * @brief Расширяет [*lo, *hi] до минимума и максимума axis
+   ************************************************************/
+  void (*bounds)(const Scalar* axis, std::size_t count, Scalar* lo,
+                 Scalar* hi);
+
+  /************************************************************
+   * @brief Однородные координаты clip[r][i] = m * (x, y, z, 1)
+   * @details matrix - 16 элементов по столбцам, clip - четыре массива
+   *для строк x, y, z, w
+   ************************************************************/
+  void (*project)(const Scalar* x, const Scalar* y, const Scalar* z,
+                  std::size_t count, const Scalar* matrix,
+                  Scalar* const* clip);
+};
+
+/************************************************************
+ * @brief Функция для определения лучшего набора инструкций процессора
+ * @return Лучший набор, под который собраны ядра
+ ************************************************************/
+SimdLevel detectSimdLevel();
+
+/************************************************************
+ * @brief Функция для получения ядер конкретного набора инструкций
+ *
+ * Если набор не поддерживается процессором или не собран, возвращаются
+ *скалярные ядра.
+ * @param level Набор инструкций
+ * @return Таблица ядер
+ ************************************************************/
+const TransformKernels& kernelsFor(SimdLevel level);
+
+/************************************************************
+ * @brief Функция для получения ядер лучшего набора инструкций
+ * @details Набор определяется один раз при первом вызове
+ * @return Таблица ядер
+ ************************************************************/
+const TransformKernels& transformKernels();
+
+/************************************************************
+ * @brief Таблицы ядер отдельных наборов инструкций
+ * @details Определены в kernels_*.cpp только для x86
+ ************************************************************/
+const TransformKernels& sse2Kernels();
+const TransformKernels& avx2Kernels();
+const TransformKernels& avx512Kernels();
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_HPP_
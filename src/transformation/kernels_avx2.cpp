@@ -0,0 +1,34 @@
+#include "kernels.hpp"
+
+/************************************************************
+ * @file kernels_avx2.cpp
+ * @brief Ядра афинных преобразований для AVX2
+ ************************************************************/
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#define S21_SIMD_TARGET __attribute__((target("avx2")))
+
+#include "kernels_impl.hpp"
+
+namespace {
+
+#ifdef S21_FLOAT32_VERTICES
+S21_SIMD_VEC(Vec, float, __m256, 8, _mm256, ps)
+#else
+S21_SIMD_VEC(Vec, double, __m256d, 4, _mm256, pd)
+#endif
+
+}  // namespace
+
+const s21::TransformKernels& s21::avx2Kernels() {
+  static const TransformKernels kernels{
+      SimdLevel::kAvx2,  translateKernel<Vec>, scaleKernel<Vec>,
+      rotateKernel<Vec>, affineKernel<Vec>,    boundsKernel<Vec>,
+      projectKernel<Vec>};
+  return kernels;
+}
+
+#endif
@@ -0,0 +1,40 @@
+#include "kernels.hpp"
+
+/************************************************************
+ * @file kernels_avx512.cpp
+ * @brief Ядра афинных преобразований для AVX-512
+ ************************************************************/
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#define S21_SIMD_TARGET __attribute__((target("avx512f")))
+// _mm512_min/max в заголовках GCC 12 передают _mm512_undefined_*() как
+// источник маски, на что -O2 выдает ложное предупреждение. clang такой
+// группы предупреждений не знает
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include "kernels_impl.hpp"
+
+namespace {
+
+#ifdef S21_FLOAT32_VERTICES
+S21_SIMD_VEC(Vec, float, __m512, 16, _mm512, ps)
+#else
+S21_SIMD_VEC(Vec, double, __m512d, 8, _mm512, pd)
+#endif
+
+}  // namespace
+
+const s21::TransformKernels& s21::avx512Kernels() {
+  static const TransformKernels kernels{
+      SimdLevel::kAvx512, translateKernel<Vec>, scaleKernel<Vec>,
+      rotateKernel<Vec>,  affineKernel<Vec>,    boundsKernel<Vec>,
+      projectKernel<Vec>};
+  return kernels;
+}
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_IMPL_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_IMPL_HPP_
+
+/************************************************************
+ * @file kernels_impl.hpp
+ * @brief Общий код ядер для всех наборов инструкций
+ *
+ * Подключается только из kernels_*.cpp, которые перед этим определяют
+ *S21_SIMD_TARGET как __attribute__((target(...))) своего набора
+ *инструкций. Атрибут ставится на каждую функцию, поэтому шаблоны
+ *собираются под набор своей единицы трансляции и в GCC, и в clang, который
+ *не поддерживает #pragma GCC target. Код лежит в безымянном пространстве
+ *имен, чтобы компоновщик не склеил экземпляры шаблонов, собранные под
+ *разные наборы.
+ *
+ * Vec описывает регистр: тип T, ширину kWidth и операции load, store,
+ *set1, add, sub, mul.
+ ************************************************************/
+
+#include <cstddef>
+
+namespace {
+
+template <typename Vec>
+S21_SIMD_TARGET void translateKernel(typename Vec::T* axis,
+                                     std::size_t count,
+                                     typename Vec::T delta) {
+  const auto d = Vec::set1(delta);
+  std::size_t i = 0;
+  for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+    Vec::store(axis + i, Vec::add(Vec::load(axis + i), d));
+  }
+  for (; i < count; i++) axis[i] += delta;
+}
+
+template <typename Vec>
+S21_SIMD_TARGET void scaleKernel(typename Vec::T* axis, std::size_t count,
+                                 typename Vec::T factor) {
+  const auto f = Vec::set1(factor);
+  std::size_t i = 0;
+  for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+    Vec::store(axis + i, Vec::mul(Vec::load(axis + i), f));
+  }
+  for (; i < count; i++) axis[i] *= factor;
+}
+
+template <typename Vec>
+S21_SIMD_TARGET void rotateKernel(typename Vec::T* u, typename Vec::T* v,
+                                  std::size_t count, typename Vec::T cos,
+                                  typename Vec::T sin) {
+  const auto c = Vec::set1(cos);
+  const auto s = Vec::set1(sin);
+  std::size_t i = 0;
+  for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+    auto a = Vec::load(u + i);
+    auto b = Vec::load(v + i);
+    Vec::store(u + i, Vec::sub(Vec::mul(a, c), Vec::mul(b, s)));
+    Vec::store(v + i, Vec::add(Vec::mul(a, s), Vec::mul(b, c)));
+  }
+  for (; i < count; i++) {
+    typename Vec::T a = u[i];
+    u[i] = a * cos - v[i] * sin;
+    v[i] = a * sin + v[i] * cos;
+  }
+}
+
+template <typename Vec>
+S21_SIMD_TARGET void affineKernel(typename Vec::T* axis, std::size_t count,
+                                  typename Vec::T factor,
+                                  typename Vec::T offset) {
+  const auto f = Vec::set1(factor);
+  const auto o = Vec::set1(offset);
+  std::size_t i = 0;
+  for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+    Vec::store(axis + i, Vec::add(Vec::mul(Vec::load(axis + i), f), o));
+  }
+  for (; i < count; i++) axis[i] = axis[i] * factor + offset;
+}
+
+template <typename Vec>
+S21_SIMD_TARGET void boundsKernel(const typename Vec::T* axis,
+                                  std::size_t count, typename Vec::T* lo,
+                                  typename Vec::T* hi) {
+  using T = typename Vec::T;
+  T low = *lo, high = *hi;
+  std::size_t i = 0;
+  if (count >= Vec::kWidth) {
+    auto vlo = Vec::set1(low);
+    auto vhi = Vec::set1(high);
+    for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+      auto a = Vec::load(axis + i);
+      vlo = Vec::min(vlo, a);
+      vhi = Vec::max(vhi, a);
+    }
+    T lanes_lo[Vec::kWidth], lanes_hi[Vec::kWidth];
+    Vec::store(lanes_lo, vlo);
+    Vec::store(lanes_hi, vhi);
+    for (std::size_t k = 0; k < Vec::kWidth; k++) {
+      if (lanes_lo[k] < low) low = lanes_lo[k];
+      if (lanes_hi[k] > high) high = lanes_hi[k];
+    }
+  }
+  for (; i < count; i++) {
+    if (axis[i] < low) low = axis[i];
+    if (axis[i] > high) high = axis[i];
+  }
+  *lo = low;
+  *hi = high;
+}
+
+template <typename Vec>
+S21_SIMD_TARGET void projectKernel(const typename Vec::T* x,
+                                   const typename Vec::T* y,
+                                   const typename Vec::T* z, std::size_t count,
+                                   const typename Vec::T* m,
+                                   typename Vec::T* const* clip) {
+  for (int r = 0; r < 4; r++) {
+    const auto mx = Vec::set1(m[r]);
+    const auto my = Vec::set1(m[4 + r]);
+    const auto mz = Vec::set1(m[8 + r]);
+    const auto mw = Vec::set1(m[12 + r]);
+    typename Vec::T* out = clip[r];
+    std::size_t i = 0;
+    for (; i + Vec::kWidth <= count; i += Vec::kWidth) {
+      auto a = Vec::add(Vec::mul(Vec::load(x + i), mx),
+                        Vec::mul(Vec::load(y + i), my));
+      a = Vec::add(a, Vec::add(Vec::mul(Vec::load(z + i), mz), mw));
+      Vec::store(out + i, a);
+    }
+    // Хвост складывает в том же порядке, что и регистры: иначе результат
+    // для вершины зависел бы от того, попала ли она в хвост части
+    for (; i < count; i++) {
+      out[i] = (x[i] * m[r] + y[i] * m[4 + r]) + (z[i] * m[8 + r] + m[12 + r]);
+    }
+  }
+}
+
+}  // namespace
+
+/************************************************************
+ * @brief Описание регистра из встроенных функций одного набора
+ * @param NAME Имя структуры
+ * @param TYPE Тип элемента
+ * @param VEC Тип регистра
+ * @param WIDTH Количество элементов в регистре
+ * @param PREFIX Префикс встроенных функций (_mm, _mm256, _mm512)
+ * @param SUFFIX Суффикс типа (pd, ps)
+ ************************************************************/
+#define S21_SIMD_VEC(NAME, TYPE, VEC, WIDTH, PREFIX, SUFFIX)                 \
+  struct NAME {                                                              \
+    using T = TYPE;                                                          \
+    static constexpr std::size_t kWidth = WIDTH;                             \
+    static S21_SIMD_TARGET VEC load(const T* p) {                            \
+      return PREFIX##_loadu_##SUFFIX(p);                                     \
+    }                                                                        \
+    static S21_SIMD_TARGET void store(T* p, VEC a) {                         \
+      PREFIX##_storeu_##SUFFIX(p, a);                                        \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC set1(T a) {                                   \
+      return PREFIX##_set1_##SUFFIX(a);                                      \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC add(VEC a, VEC b) {                           \
+      return PREFIX##_add_##SUFFIX(a, b);                                    \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC sub(VEC a, VEC b) {                           \
+      return PREFIX##_sub_##SUFFIX(a, b);                                    \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC mul(VEC a, VEC b) {                           \
+      return PREFIX##_mul_##SUFFIX(a, b);                                    \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC min(VEC a, VEC b) {                           \
+      return PREFIX##_min_##SUFFIX(a, b);                                    \
+    }                                                                        \
+    static S21_SIMD_TARGET VEC max(VEC a, VEC b) {                           \
+      return PREFIX##_max_##SUFFIX(a, b);                                    \
+    }                                                                        \
+  };
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_KERNELS_IMPL_HPP_
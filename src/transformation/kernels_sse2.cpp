@@ -0,0 +1,34 @@
+#include "kernels.hpp"
+
+/************************************************************
+ * @file kernels_sse2.cpp
+ * @brief Ядра афинных преобразований для SSE2
+ ************************************************************/
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#define S21_SIMD_TARGET __attribute__((target("sse2")))
+
+#include "kernels_impl.hpp"
+
+namespace {
+
+#ifdef S21_FLOAT32_VERTICES
+S21_SIMD_VEC(Vec, float, __m128, 4, _mm, ps)
+#else
+S21_SIMD_VEC(Vec, double, __m128d, 2, _mm, pd)
+#endif
+
+}  // namespace
+
+const s21::TransformKernels& s21::sse2Kernels() {
+  static const TransformKernels kernels{
+      SimdLevel::kSse2,  translateKernel<Vec>, scaleKernel<Vec>,
+      rotateKernel<Vec>, affineKernel<Vec>,    boundsKernel<Vec>,
+      projectKernel<Vec>};
+  return kernels;
+}
+
+#endif
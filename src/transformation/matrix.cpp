@@ -0,0 +1,142 @@
+#include "matrix.hpp"
+
+#include <cmath>
+
+/************************************************************
+ * @file matrix.cpp
+ * @brief Матрица аффинного преобразования 4x4
+ ************************************************************/
+
+using namespace s21;
+
+Matrix4::Matrix4() : m_{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1} {}
+
+Matrix4 Matrix4::fromMovement(Movement move, double value) {
+  Matrix4 res;
+  double angle = value * M_PI / 180;
+  double c = std::cos(angle), s = std::sin(angle);
+  switch (move) {
+    case MoveX:
+      res(0, 3) = value;
+      break;
+    case MoveY:
+      res(1, 3) = value;
+      break;
+    case MoveZ:
+      res(2, 3) = value;
+      break;
+    case RotateX:
+      res(1, 1) = c;
+      res(1, 2) = -s;
+      res(2, 1) = s;
+      res(2, 2) = c;
+      break;
+    case RotateY:
+      res(0, 0) = c;
+      res(0, 2) = s;
+      res(2, 0) = -s;
+      res(2, 2) = c;
+      break;
+    case RotateZ:
+      res(0, 0) = c;
+      res(0, 1) = -s;
+      res(1, 0) = s;
+      res(1, 1) = c;
+      break;
+    case SCALE:
+      res(0, 0) = value;
+      res(1, 1) = value;
+      res(2, 2) = value;
+      break;
+  }
+  return res;
+}
+
+Matrix4 Matrix4::fromOperations(
+    const std::vector<TransformOperation>& operations) {
+  Matrix4 res;
+  for (const TransformOperation& operation : operations) {
+    res = fromMovement(operation.move, operation.value) * res;
+  }
+  return res;
+}
+
+Matrix4 Matrix4::orthographic(double left, double right, double bottom,
+                              double top, double z_near, double z_far) {
+  Matrix4 res;
+  res(0, 0) = 2 / (right - left);
+  res(1, 1) = 2 / (top - bottom);
+  res(2, 2) = -2 / (z_far - z_near);
+  res(0, 3) = -(right + left) / (right - left);
+  res(1, 3) = -(top + bottom) / (top - bottom);
+  res(2, 3) = -(z_far + z_near) / (z_far - z_near);
+  return res;
+}
+
+Matrix4 Matrix4::frustum(double left, double right, double bottom, double top,
+                         double z_near, double z_far) {
+  Matrix4 res;
+  res(0, 0) = 2 * z_near / (right - left);
+  res(1, 1) = 2 * z_near / (top - bottom);
+  res(0, 2) = (right + left) / (right - left);
+  res(1, 2) = (top + bottom) / (top - bottom);
+  res(2, 2) = -(z_far + z_near) / (z_far - z_near);
+  res(2, 3) = -2 * z_far * z_near / (z_far - z_near);
+  res(3, 2) = -1;
+  res(3, 3) = 0;
+  return res;
+}
+
+Matrix4 Matrix4::operator*(const Matrix4& other) const {
+  Matrix4 res;
+  for (int row = 0; row < 4; row++) {
+    for (int col = 0; col < 4; col++) {
+      double sum = 0;
+      for (int k = 0; k < 4; k++) sum += (*this)(row, k) * other(k, col);
+      res(row, col) = sum;
+    }
+  }
+  return res;
+}
+
+bool Matrix4::isIdentity() const {
+  for (int row = 0; row < 4; row++) {
+    for (int col = 0; col < 4; col++) {
+      if ((*this)(row, col) != (row == col ? 1 : 0)) return false;
+    }
+  }
+  return true;
+}
+
+Point Matrix4::apply(const Point& p) const {
+  const Matrix4& a = *this;
+  return Point(a(0, 0) * p.x + a(0, 1) * p.y + a(0, 2) * p.z + a(0, 3),
+               a(1, 0) * p.x + a(1, 1) * p.y + a(1, 2) * p.z + a(1, 3),
+               a(2, 0) * p.x + a(2, 1) * p.y + a(2, 2) * p.z + a(2, 3));
+}
+
+void Matrix4::apply(const VertexArray& source, VertexArray& target) const {
+  if (&source != &target) target.resize(source.size());
+  applyArrays(source.x(), source.y(), source.z(), target.x(), target.y(),
+              target.z(), source.size());
+}
+
+void Matrix4::apply(VertexRange range) const {
+  applyArrays(range.x, range.y, range.z, range.x, range.y, range.z,
+              range.size);
+}
+
+void Matrix4::applyArrays(const Scalar* sx, const Scalar* sy,
+                          const Scalar* sz, Scalar* tx, Scalar* ty,
+                          Scalar* tz, std::size_t count) const {
+  const double m00 = m_[0], m10 = m_[1], m20 = m_[2];
+  const double m01 = m_[4], m11 = m_[5], m21 = m_[6];
+  const double m02 = m_[8], m12 = m_[9], m22 = m_[10];
+  const double m03 = m_[12], m13 = m_[13], m23 = m_[14];
+  for (std::size_t i = 0; i < count; i++) {
+    double x = sx[i], y = sy[i], z = sz[i];
+    tx[i] = static_cast<Scalar>(m00 * x + m01 * y + m02 * z + m03);
+    ty[i] = static_cast<Scalar>(m10 * x + m11 * y + m12 * z + m13);
+    tz[i] = static_cast<Scalar>(m20 * x + m21 * y + m22 * z + m23);
+  }
+}
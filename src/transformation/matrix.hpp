@@ -0,0 +1,118 @@
+#ifndef CPP4_3DVIEWER_V2_0_1_SRC_3D_MATRIX_HPP_
+#define CPP4_3DVIEWER_V2_0_1_SRC_3D_MATRIX_HPP_
+
+/************************************************************
+ * @file matrix.hpp
+ * @brief Матрица аффинного преобразования 4x4
+ ************************************************************/
+
+#include <vector>
+
+#include "../object/object.hpp"
+#include "transformation.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Класс матрицы аффинного преобразования
+ *
+ * Элементы хранятся по столбцам, как в OpenGL, поэтому data() можно сразу
+ *передать в glMultMatrixd или в uniform шейдера.
+ ************************************************************/
+class Matrix4 {
+ public:
+  /************************************************************
+   * @brief Конструктор по умолчанию
+   * @details Создает единичную матрицу
+   ************************************************************/
+  Matrix4();
+
+  /************************************************************
+   * @brief Матрица одного преобразования
+   *
+   * Значения трактуются так же, как в стратегиях Move, Rotate и Scale:
+   *шаг перемещения, угол поворота в градусах или коэффициент
+   *масштабирования.
+   * @param move Название преобразования
+   * @param value Значение преобразования
+   * @return Матрица преобразования
+   ************************************************************/
+  static Matrix4 fromMovement(Movement move, double value);
+
+  /************************************************************
+   * @brief Матрица пакета преобразований
+   * @param operations Преобразования в порядке применения
+   * @return Произведение матриц, применяющее их по порядку
+   ************************************************************/
+  static Matrix4 fromOperations(
+      const std::vector<TransformOperation>& operations);
+
+  /************************************************************
+   * @brief Матрица параллельной проекции, как у glOrtho
+   ************************************************************/
+  static Matrix4 orthographic(double left, double right, double bottom,
+                              double top, double z_near, double z_far);
+
+  /************************************************************
+   * @brief Матрица центральной проекции, как у glFrustum
+   * @details Не аффинная: apply для нее не подходит, она передается в
+   *шейдер, который делит на w
+   ************************************************************/
+  static Matrix4 frustum(double left, double right, double bottom, double top,
+                         double z_near, double z_far);
+
+  /************************************************************
+   * @brief Элемент в строке row и столбце col
+   ************************************************************/
+  double operator()(int row, int col) const { return m_[col * 4 + row]; }
+  double& operator()(int row, int col) { return m_[col * 4 + row]; }
+
+  /************************************************************
+   * @brief Композиция преобразований
+   * @details (a * b) применяет сначала b, затем a
+   ************************************************************/
+  Matrix4 operator*(const Matrix4& other) const;
+
+  /************************************************************
+   * @brief Проверка на единичную матрицу
+   ************************************************************/
+  bool isIdentity() const;
+
+  /************************************************************
+   * @brief Метод для применения матрицы к точке
+   * @param p Точка
+   * @return Преобразованная точка
+   ************************************************************/
+  Point apply(const Point& p) const;
+
+  /************************************************************
+   * @brief Метод для применения матрицы ко всем вершинам за один проход
+   * @param source Исходные вершины
+   * @param target Куда записать результат, может совпадать с source
+   * @return void
+   ************************************************************/
+  void apply(const VertexArray& source, VertexArray& target) const;
+
+  /************************************************************
+   * @brief Метод для применения матрицы к участку вершин на месте
+   * @param range Участок вершин
+   * @return void
+   ************************************************************/
+  void apply(VertexRange range) const;
+
+  /************************************************************
+   * @brief Элементы матрицы по столбцам
+   ************************************************************/
+  const double* data() const { return m_; }
+
+ private:
+  void applyArrays(const Scalar* sx, const Scalar* sy, const Scalar* sz,
+                   Scalar* tx, Scalar* ty, Scalar* tz,
+                   std::size_t count) const;
+
+  double m_[16];
+};
+
+}  // namespace s21
+
+#endif  // CPP4_3DVIEWER_V2_0_1_SRC_3D_MATRIX_HPP_
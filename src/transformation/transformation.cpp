@@ -1,6 +1,6 @@
 #include "transformation.hpp"
 
-#include <cmath>
+#include "axis_transform.hpp"
 
 /************************************************************
  * @file transformation.cpp
@@ -9,7 +9,7 @@
 
 using namespace s21;
 
-void Move::Transform(std::vector<Point>& vertexes, Movement move, double step) {
+void Move::Transform(VertexRange vertexes, Movement move, double step) {
   switch (move) {
     case MoveX:
       moveX(vertexes, step);
@@ -25,27 +25,19 @@ void Move::Transform(std::vector<Point>& vertexes, Movement move, double step) {
   }
 }
 
-void Move::moveX(std::vector<Point>& vertexes, double step) {
-  for (Point& p : vertexes) {
-    p.x += step;
-  }
+void Move::moveX(VertexRange vertexes, double step) {
+  AxisTransform<Translation, Axis::kX>::Transform(vertexes, step);
 }
 
-void Move::moveY(std::vector<Point>& vertexes, double step) {
-  for (Point& p : vertexes) {
-    p.y += step;
-  }
+void Move::moveY(VertexRange vertexes, double step) {
+  AxisTransform<Translation, Axis::kY>::Transform(vertexes, step);
 }
 
-void Move::moveZ(std::vector<Point>& vertexes, double step) {
-  for (Point& p : vertexes) {
-    p.z += step;
-  }
+void Move::moveZ(VertexRange vertexes, double step) {
+  AxisTransform<Translation, Axis::kZ>::Transform(vertexes, step);
 }
 
-void Rotate::Transform(std::vector<Point>& vertexes, Movement move,
-                       double angle) {
-  angle = angle * M_PI / 180;
+void Rotate::Transform(VertexRange vertexes, Movement move, double angle) {
   switch (move) {
     case RotateX:
       rotateX(vertexes, angle);
@@ -61,51 +53,42 @@ void Rotate::Transform(std::vector<Point>& vertexes, Movement move,
   }
 }
 
-void Rotate::rotateX(std::vector<Point>& vertexes, double angle) {
-  for (Point& p : vertexes) {
-    double tmpY = p.y;
-    p.y = p.y * std::cos(angle) - p.z * std::sin(angle);
-    p.z = tmpY * std::sin(angle) + p.z * std::cos(angle);
-  }
+void Rotate::rotateX(VertexRange vertexes, double angle) {
+  AxisTransform<Rotation, Axis::kX>::Transform(vertexes, angle);
 }
 
-void Rotate::rotateY(std::vector<Point>& vertexes, double angle) {
-  for (Point& p : vertexes) {
-    double tmpX = p.x;
-    p.x = p.x * std::cos(angle) + p.z * std::sin(angle);
-    p.z = -tmpX * std::sin(angle) + p.z * std::cos(angle);
-  }
+void Rotate::rotateY(VertexRange vertexes, double angle) {
+  AxisTransform<Rotation, Axis::kY>::Transform(vertexes, angle);
 }
 
-void Rotate::rotateZ(std::vector<Point>& vertexes, double angle) {
-  for (Point& p : vertexes) {
-    double tmpX = p.x;
-    p.x = p.x * std::cos(angle) - p.y * std::sin(angle);
-    p.y = tmpX * std::sin(angle) + p.y * std::cos(angle);
-  }
+void Rotate::rotateZ(VertexRange vertexes, double angle) {
+  AxisTransform<Rotation, Axis::kZ>::Transform(vertexes, angle);
 }
 
-void Scale::Transform(std::vector<Point>& vertexes, Movement move,
-                      double scal) {
+void Scale::Transform(VertexRange vertexes, Movement move, double scal) {
   if (move == SCALE)
     scale(vertexes, scal);
   else
     return;
 }
 
-void Scale::scale(std::vector<Point>& vertexes, double scal) {
-  for (Point& p : vertexes) {
-    p.x *= scal;
-    p.y *= scal;
-    p.z *= scal;
-  }
+void Scale::scale(VertexRange vertexes, double scal) {
+  AxisTransform<Scaling, Axis::kAll>::Transform(vertexes, scal);
 }
 
 void ObjectTransformer::set_strategy(TransformationStrategy* strategy) {
   strategy_ = strategy;
 }
 
-void ObjectTransformer::TransformModel(std::vector<Point>& vertexes,
+void ObjectTransformer::set_policy(const ExecutionPolicy& policy) {
+  policy_ = policy;
+}
+
+void ObjectTransformer::TransformModel(VertexArray& vertexes,
                                        Movement move, double value) {
-  strategy_->Transform(vertexes, move, value);
+  forEachRange(policy_, vertexes.size(),
+               [&](std::size_t, std::size_t first, std::size_t last) {
+                 strategy_->Transform(vertexes.range(first, last), move,
+                                      value);
+               });
 }
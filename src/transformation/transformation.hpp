@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "../object/object.hpp"
+#include "execution.hpp"
 
 namespace s21 {
 
@@ -21,6 +22,21 @@ namespace s21 {
  ************************************************************/
 enum Movement { MoveX, MoveY, MoveZ, RotateX, RotateY, RotateZ, SCALE };
 
+/************************************************************
+ * @brief Одно преобразование из пакета
+ ************************************************************/
+struct TransformOperation {
+  /************************************************************
+   * @brief Название преобразования
+   ************************************************************/
+  Movement move;
+
+  /************************************************************
+   * @brief Шаг, угол или коэффициент масштабирования
+   ************************************************************/
+  double value;
+};
+
 /************************************************************
  * @brief Класс афинных преобразований
  *
@@ -37,8 +53,7 @@ class TransformationStrategy {
    * @param value Значение, указывающий или шаг, или угол, или коэффициент
    *масштабирования
    ************************************************************/
-  virtual void Transform(std::vector<Point>& vertexes, Movement move,
-                         double value) = 0;
+  virtual void Transform(VertexRange vertexes, Movement move, double value) = 0;
 };
 
 /************************************************************
@@ -55,8 +70,7 @@ class Rotate : public TransformationStrategy {
    * @param move Название преобразования: поворото по X, Y или Z
    * @param value Значение, указывающий угол поворота
    ************************************************************/
-  void Transform(std::vector<Point>& vertexes, Movement move,
-                 double angle) override;
+  void Transform(VertexRange vertexes, Movement move, double angle) override;
 
  private:
   /************************************************************
@@ -66,7 +80,7 @@ class Rotate : public TransformationStrategy {
    * @param vertexes Вектор, который будем поворачивать
    * @param value Значение, указывающий угол поворота
    ************************************************************/
-  void rotateX(std::vector<Point>& vertexes, double angle);
+  void rotateX(VertexRange vertexes, double angle);
 
   /************************************************************
    * @brief Метод поворота модели по оси Y
@@ -75,7 +89,7 @@ class Rotate : public TransformationStrategy {
    * @param vertexes Вектор, который будем поворачивать
    * @param value Значение, указывающий угол поворота
    ************************************************************/
-  void rotateY(std::vector<Point>& vertexes, double angle);
+  void rotateY(VertexRange vertexes, double angle);
 
   /************************************************************
    * @brief Метод поворота модели по оси Z
@@ -84,7 +98,7 @@ class Rotate : public TransformationStrategy {
    * @param vertexes Вектор, который будем поворачивать
    * @param value Значение, указывающий угол поворота
    ************************************************************/
-  void rotateZ(std::vector<Point>& vertexes, double angle);
+  void rotateZ(VertexRange vertexes, double angle);
 };
 
 /************************************************************
@@ -101,8 +115,7 @@ class Move : public TransformationStrategy {
    * @param move Название преобразования: перемещение по X, Y или Z
    * @param value Значение, указывающий шаг перемещения
    ************************************************************/
-  void Transform(std::vector<Point>& vertexes, Movement move,
-                 double step) override;
+  void Transform(VertexRange vertexes, Movement move, double step) override;
 
  private:
   /************************************************************
@@ -112,7 +125,7 @@ class Move : public TransformationStrategy {
    * @param vertexes Вектор, над которым буде произведена операция перемещения
    * @param value Значение, указывающий шаг перемещения
    ************************************************************/
-  void moveX(std::vector<Point>& vertexes, double step);
+  void moveX(VertexRange vertexes, double step);
 
   /************************************************************
    * @brief Метод перемещения по оси Y
@@ -121,7 +134,7 @@ class Move : public TransformationStrategy {
    * @param vertexes Вектор, над которым буде произведена операция перемещения
    * @param value Значение, указывающий шаг перемещения
    ************************************************************/
-  void moveY(std::vector<Point>& vertexes, double step);
+  void moveY(VertexRange vertexes, double step);
 
   /************************************************************
    * @brief Метод перемещения по оси Z
@@ -130,7 +143,7 @@ class Move : public TransformationStrategy {
    * @param vertexes Вектор, над которым буде произведена операция перемещения
    * @param value Значение, указывающий шаг перемещения
    ************************************************************/
-  void moveZ(std::vector<Point>& vertexes, double step);
+  void moveZ(VertexRange vertexes, double step);
 };
 
 /************************************************************
@@ -146,8 +159,7 @@ class Scale : public TransformationStrategy {
    * @param move Название преобразования: масштабирование (SCALE)
    * @param value Коэффициент масштабирования
    ************************************************************/
-  void Transform(std::vector<Point>& vertexes, Movement move,
-                 double step) override;
+  void Transform(VertexRange vertexes, Movement move, double step) override;
 
  private:
   /************************************************************
@@ -157,7 +169,7 @@ class Scale : public TransformationStrategy {
    *масштабирования
    * @param value Коэффициент масштабирования
    ************************************************************/
-  void scale(std::vector<Point>& vertexes, double scal);
+  void scale(VertexRange vertexes, double scal);
 };
 
 /************************************************************
@@ -165,6 +177,7 @@ class Scale : public TransformationStrategy {
  ************************************************************/
 class ObjectTransformer {
   TransformationStrategy* strategy_;
+  ExecutionPolicy policy_;
 
  public:
   /************************************************************
@@ -181,6 +194,15 @@ class ObjectTransformer {
    ************************************************************/
   void set_strategy(TransformationStrategy* strategy);
 
+  /************************************************************
+   * @brief Метод для выбора политики выполнения
+   *
+   * Большие модели делятся на части, которые стратегия преобразует
+   *параллельно в общем пуле потоков.
+   * @param policy Политика выполнения
+   ************************************************************/
+  void set_policy(const ExecutionPolicy& policy);
+
   /************************************************************
    * @brief Метод преобразования модели
    *
@@ -191,8 +213,7 @@ class ObjectTransformer {
    * @param value Значение, указывающий или шаг, или угол, или коэффициент
    *масштабирования
    ************************************************************/
-  void TransformModel(std::vector<Point>& vertexes, Movement move,
-                      double value);
+  void TransformModel(VertexArray& vertexes, Movement move, double value);
 };
 
 }  // namespace s21
@@ -1,8 +1,17 @@
 #include <QApplication>
+#include <QSurfaceFormat>
 
 #include "view.h"
 
 int main(int argc, char *argv[]) {
+  // Отрисовка использует функции compatibility профиля: широкие линии и
+  // GL_POINT_SPRITE. Контекст OpenGL 3.0 поддерживает шейдеры GLSL 1.30,
+  // а где дается только OpenGL 2.1, ModelRenderer берет вариант на 1.20
+  QSurfaceFormat format;
+  format.setVersion(3, 0);
+  format.setProfile(QSurfaceFormat::CompatibilityProfile);
+  format.setDepthBufferSize(24);
+  QSurfaceFormat::setDefaultFormat(format);
   QApplication a(argc, argv);
   View w;
   w.setWindowFlags(Qt::Window | Qt::WindowMinimizeButtonHint |
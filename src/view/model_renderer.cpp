@@ -0,0 +1,334 @@
+#include "model_renderer.h"
+
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+#include <climits>
+
+#ifndef GL_PROGRAM_POINT_SIZE
+#define GL_PROGRAM_POINT_SIZE 0x8642
+#endif
+#ifndef GL_POINT_SPRITE
+#define GL_POINT_SPRITE 0x8861
+#endif
+
+namespace {
+
+/************************************************************
+ * @brief Номер атрибута координат вершины
+ ************************************************************/
+constexpr GLuint kPositionAttribute = 0;
+
+/************************************************************
+ * @brief Длина штриха и пропуска пунктира в пикселях
+ ************************************************************/
+constexpr float kDashLength = 8.f;
+
+// screen - координаты фрагмента на экране без перспективной коррекции,
+// anchor - координаты последней (определяющей) вершины отрезка, одинаковые
+// для всего отрезка, от них отсчитывается пунктир
+const char* const kVertexShader = R"(#version 130
+in vec3 position;
+uniform mat4 mvp;
+uniform float point_size;
+noperspective out vec2 screen;
+flat out vec2 anchor;
+
+void main() {
+  gl_Position = mvp * vec4(position, 1.0);
+  screen = gl_Position.xy / gl_Position.w;
+  anchor = screen;
+  gl_PointSize = point_size;
+}
+)";
+
+const char* const kFragmentShader = R"(#version 130
+uniform vec3 color;
+uniform vec2 viewport;
+uniform bool points;
+uniform bool round_points;
+uniform bool dashed;
+uniform float dash_length;
+noperspective in vec2 screen;
+flat in vec2 anchor;
+
+void main() {
+  if (points && round_points && length(gl_PointCoord - vec2(0.5)) > 0.5) {
+    discard;
+  }
+  if (!points && dashed) {
+    float distance = length((screen - anchor) * viewport * 0.5);
+    if (mod(distance, 2.0 * dash_length) >= dash_length) discard;
+  }
+  gl_FragColor = vec4(color, 1.0);
+}
+)";
+
+// Вариант для OpenGL 2.1: в GLSL 1.20 нет flat, поэтому пунктир рисуется
+// не шейдером, а через glLineStipple compatibility профиля
+const char* const kVertexShader120 = R"(#version 120
+attribute vec3 position;
+uniform mat4 mvp;
+uniform float point_size;
+
+void main() {
+  gl_Position = mvp * vec4(position, 1.0);
+  gl_PointSize = point_size;
+}
+)";
+
+const char* const kFragmentShader120 = R"(#version 120
+uniform vec3 color;
+uniform bool points;
+uniform bool round_points;
+
+void main() {
+  if (points && round_points && length(gl_PointCoord - vec2(0.5)) > 0.5) {
+    discard;
+  }
+  gl_FragColor = vec4(color, 1.0);
+}
+)";
+
+/************************************************************
+ * @brief Собирает программу из шейдеров vertex и fragment
+ ************************************************************/
+bool linkProgram(QOpenGLShaderProgram& program, const char* vertex,
+                 const char* fragment) {
+  program.removeAllShaders();
+  program.addShaderFromSourceCode(QOpenGLShader::Vertex, vertex);
+  program.addShaderFromSourceCode(QOpenGLShader::Fragment, fragment);
+  program.bindAttributeLocation("position", kPositionAttribute);
+  return program.link();
+}
+
+/************************************************************
+ * @brief Наибольшее число вершин или индексов в одном вызове отрисовки
+ * @details Количество передается в GLsizei
+ ************************************************************/
+constexpr std::size_t kMaxDrawCount = INT_MAX;
+
+}  // namespace
+
+s21::ModelRenderer::ModelRenderer()
+    : vertex_buffer_{QOpenGLBuffer::VertexBuffer},
+      index_buffer_{QOpenGLBuffer::IndexBuffer} {}
+
+bool s21::ModelRenderer::initialize() {
+  initializeOpenGLFunctions();
+  vertex_buffer_.create();
+  vertex_buffer_.setUsagePattern(QOpenGLBuffer::StaticDraw);
+  index_buffer_.create();
+  index_buffer_.setUsagePattern(QOpenGLBuffer::StaticDraw);
+  revision_ = UINT64_MAX;
+  streamed_ = false;
+
+  legacy_ = false;
+  ready_ = linkProgram(program_, kVertexShader, kFragmentShader);
+  if (!ready_) {
+    // Контекст без GLSL 1.30, например OpenGL 2.1 на macOS
+    QString log = program_.log();
+    legacy_ = true;
+    ready_ = linkProgram(program_, kVertexShader120, kFragmentShader120);
+    if (!ready_) {
+      qWarning("Model shaders: %s\n%s", qPrintable(log),
+               qPrintable(program_.log()));
+      return false;
+    }
+  }
+  // Размер вершины задает шейдер, а gl_PointCoord в compatibility профиле
+  // определен только для спрайтов
+  glEnable(GL_PROGRAM_POINT_SIZE);
+  glEnable(GL_POINT_SPRITE);
+  return true;
+}
+
+void s21::ModelRenderer::destroy() {
+  vertex_buffer_.destroy();
+  index_buffer_.destroy();
+  program_.removeAllShaders();
+  dropModel();
+  ready_ = false;
+}
+
+void s21::ModelRenderer::sync(Controller& controller) {
+  if (controller.revision() == revision_) return;
+  revision_ = controller.revision();
+  const Object& object = controller.getObject();
+  bool streaming = controller.isStreaming();
+  // Пока загрузка только дописывает модель, в буферы отправляется лишь
+  // то, что пришло после прошлой синхронизации
+  bool append = streaming && streamed_ &&
+                controller.rewriteRevision() == rewrite_revision_;
+  rewrite_revision_ = controller.rewriteRevision();
+  streamed_ = streaming;
+  // Ошибки прошлых вызовов сбрасываются, чтобы проверить только загрузку
+  while (glGetError() != GL_NO_ERROR) {
+  }
+  bool uploaded =
+      uploadVertexes(object.vertexes, append) &&
+      (streaming ? uploadFaces(object.lines, object.vertexes.size(), append)
+                 : uploadEdges(object.edges));
+  if (!uploaded || glGetError() == GL_OUT_OF_MEMORY) {
+    qWarning("Model does not fit into video memory and is not drawn");
+    dropModel();
+  }
+}
+
+void s21::ModelRenderer::setTransform(const Matrix4& mvp, int width,
+                                      int height) {
+  if (!ready_) return;
+  std::array<GLfloat, 16> elements;
+  for (std::size_t i = 0; i < elements.size(); i++) {
+    elements[i] = static_cast<GLfloat>(mvp.data()[i]);
+  }
+  program_.bind();
+  glUniformMatrix4fv(program_.uniformLocation("mvp"), 1, GL_FALSE,
+                     elements.data());
+  program_.setUniformValue("viewport", static_cast<GLfloat>(width),
+                           static_cast<GLfloat>(height));
+  program_.setUniformValue("dash_length", kDashLength);
+  program_.release();
+}
+
+bool s21::ModelRenderer::reserveBuffer(GLenum target, std::size_t& capacity,
+                                       std::size_t needed, bool append) {
+  if (append && needed <= capacity) return false;
+  // При дописывании емкость растет хотя бы вдвое, поэтому модель из N
+  // байт перевыделяется O(log N) раз
+  capacity = append ? std::max(needed, capacity * 2) : needed;
+  glBufferData(target, static_cast<qopengl_GLsizeiptr>(capacity), nullptr,
+               GL_STATIC_DRAW);
+  return true;
+}
+
+void s21::ModelRenderer::writeBuffer(GLenum target, std::size_t offset,
+                                     const void* data, std::size_t size) {
+  if (size == 0) return;
+  glBufferSubData(target, static_cast<qopengl_GLintptr>(offset),
+                  static_cast<qopengl_GLsizeiptr>(size), data);
+}
+
+void s21::ModelRenderer::dropModel() {
+  lines_.clear();
+  face_count_ = 0;
+  streamed_ = false;
+  vertex_count_ = 0;
+  index_count_ = 0;
+  vertex_capacity_ = 0;
+  index_capacity_ = 0;
+}
+
+bool s21::ModelRenderer::uploadVertexes(const VertexArray& vertexes,
+                                        bool append) {
+  constexpr std::size_t kStride = 3 * sizeof(float);
+  if (vertexes.size() > kMaxDrawCount) return false;
+  std::size_t first = append ? static_cast<std::size_t>(vertex_count_) : 0;
+  vertex_buffer_.bind();
+  if (reserveBuffer(GL_ARRAY_BUFFER, vertex_capacity_,
+                    vertexes.size() * kStride, append)) {
+    first = 0;
+  }
+  std::vector<float> buffer = vertexes.interleaved(first);
+  writeBuffer(GL_ARRAY_BUFFER, first * kStride, buffer.data(),
+              buffer.size() * sizeof(float));
+  vertex_buffer_.release();
+  vertex_count_ = static_cast<GLsizei>(vertexes.size());
+  return true;
+}
+
+bool s21::ModelRenderer::uploadEdges(const EdgeTable& edges) {
+  static_assert(sizeof(Edge) == 2 * sizeof(GLuint));
+  lines_.clear();
+  if (edges.size() > kMaxDrawCount / 2) return false;
+  std::size_t size = edges.size() * sizeof(Edge);
+  index_buffer_.bind();
+  reserveBuffer(GL_ELEMENT_ARRAY_BUFFER, index_capacity_, size, false);
+  writeBuffer(GL_ELEMENT_ARRAY_BUFFER, 0, edges.data(), size);
+  index_buffer_.release();
+  index_count_ = static_cast<GLsizei>(edges.size() * 2);
+  return true;
+}
+
+bool s21::ModelRenderer::uploadFaces(const FaceArray& faces,
+                                     std::size_t vertex_count, bool append) {
+  if (!append) {
+    lines_.clear();
+    face_count_ = 0;
+  }
+  std::size_t first = lines_.size();
+  // Полигоны ссылаются только на уже прочитанные вершины, поэтому
+  // отброшенный полигон не станет верным в следующих пачках
+  for (; face_count_ < faces.size(); face_count_++) {
+    Face f = faces[face_count_];
+    IndexSpan face = f.indexes;
+    std::size_t n = face.size();
+    if (n < 2) continue;
+    bool valid = true;
+    for (int p : face) {
+      valid = valid && p >= 0 && static_cast<std::size_t>(p) < vertex_count;
+    }
+    if (!valid) continue;
+    std::size_t count = n == 2 || f.open ? n - 1 : n;
+    for (std::size_t k = 0; k < count; k++) {
+      lines_.push_back(static_cast<GLuint>(face[k]));
+      lines_.push_back(static_cast<GLuint>(face[(k + 1) % n]));
+    }
+  }
+  if (lines_.size() > kMaxDrawCount) return false;
+  index_buffer_.bind();
+  if (reserveBuffer(GL_ELEMENT_ARRAY_BUFFER, index_capacity_,
+                    lines_.size() * sizeof(GLuint), append)) {
+    first = 0;
+  }
+  writeBuffer(GL_ELEMENT_ARRAY_BUFFER, first * sizeof(GLuint),
+              lines_.data() + first, (lines_.size() - first) * sizeof(GLuint));
+  index_buffer_.release();
+  index_count_ = static_cast<GLsizei>(lines_.size());
+  return true;
+}
+
+void s21::ModelRenderer::bindVertexes() {
+  program_.bind();
+  vertex_buffer_.bind();
+  glEnableVertexAttribArray(kPositionAttribute);
+  glVertexAttribPointer(kPositionAttribute, 3, GL_FLOAT, GL_FALSE, 0,
+                        nullptr);
+}
+
+void s21::ModelRenderer::releaseVertexes() {
+  glDisableVertexAttribArray(kPositionAttribute);
+  vertex_buffer_.release();
+  program_.release();
+}
+
+void s21::ModelRenderer::drawEdges(Color color, float width, bool dashed) {
+  if (!ready_ || index_count_ == 0) return;
+  glLineWidth(width);
+  bindVertexes();
+  program_.setUniformValue("color", color.red, color.green, color.blue);
+  program_.setUniformValue("points", GL_FALSE);
+  program_.setUniformValue("dashed", static_cast<GLint>(dashed));
+  // Шейдеры GLSL 1.20 пунктир не рисуют: 8 пикселей линии, 8 пропуска
+  bool stipple = legacy_ && dashed;
+  if (stipple) {
+    glLineStipple(1, 0x00FF);
+    glEnable(GL_LINE_STIPPLE);
+  }
+  index_buffer_.bind();
+  glDrawElements(GL_LINES, index_count_, GL_UNSIGNED_INT, nullptr);
+  index_buffer_.release();
+  if (stipple) glDisable(GL_LINE_STIPPLE);
+  releaseVertexes();
+}
+
+void s21::ModelRenderer::drawVertices(Color color, float size, bool round) {
+  if (!ready_ || vertex_count_ == 0) return;
+  bindVertexes();
+  program_.setUniformValue("color", color.red, color.green, color.blue);
+  program_.setUniformValue("points", GL_TRUE);
+  program_.setUniformValue("round_points", static_cast<GLint>(round));
+  program_.setUniformValue("point_size", size);
+  glDrawArrays(GL_POINTS, 0, vertex_count_);
+  releaseVertexes();
+}
@@ -0,0 +1,112 @@
+#ifndef MODEL_RENDERER_H
+#define MODEL_RENDERER_H
+
+#include <QOpenGLBuffer>
+#include <QOpenGLFunctions>
+#include <QOpenGLShaderProgram>
+#include <cstdint>
+#include <vector>
+
+#include "../controller/controller.h"
+#include "../render/image.hpp"
+
+namespace s21 {
+
+/************************************************************
+ * @brief Отрисовка модели из буферов видеопамяти
+ *
+ * Координаты вершин и индексы ребер загружаются в VBO и IBO только после
+ * изменения модели (Controller::revision), а кадр рисует все ребра одним
+ * glDrawElements(GL_LINES) и все вершины одним glDrawArrays(GL_POINTS).
+ * Перемещение, поворот, масштаб и проекция передаются в шейдер матрицей
+ * mvp, поэтому при вращении модели буферы не меняются. Пунктир и круглые
+ * вершины тоже рисует шейдер, вместо glLineStipple и GL_POINT_SMOOTH.
+ * Шейдеры написаны на GLSL 1.30 и работают под Mesa llvmpipe. Если
+ * контекст дает только OpenGL 2.1, собирается вариант на GLSL 1.20, а
+ * пунктир рисуется через glLineStipple.
+ ************************************************************/
+class ModelRenderer : protected QOpenGLFunctions {
+ public:
+  ModelRenderer();
+
+  /************************************************************
+   * @brief Собирает шейдеры и создает буферы
+   *
+   * Вызывается при текущем контексте OpenGL.
+   * @return false, если шейдеры не собрались, причина пишется в qWarning
+   ************************************************************/
+  bool initialize();
+
+  /************************************************************
+   * @brief Освобождает буферы, вызывается при текущем контексте OpenGL
+   ************************************************************/
+  void destroy();
+
+  /************************************************************
+   * @brief Загружает модель в буферы, если она изменилась
+   *
+   * Пока идет потоковая загрузка, таблицы ребер еще нет, и индексы
+   * собираются из контуров полигонов с проверкой номеров вершин. Новые
+   * вершины и полигоны дописываются в буферы через glBufferSubData, а
+   * емкость буферов растет вдвое, так что вся загрузка стоит O(N). Если
+   * модель не помещается в видеопамять, она не рисуется, а причина
+   * пишется в qWarning.
+   ************************************************************/
+  void sync(Controller& controller);
+
+  /************************************************************
+   * @brief Задает преобразование кадра
+   * @param mvp Произведение проекции и матрицы модели
+   * @param width Ширина области вывода в пикселях
+   * @param height Высота области вывода в пикселях
+   ************************************************************/
+  void setTransform(const Matrix4& mvp, int width, int height);
+
+  /************************************************************
+   * @brief Рисует все ребра модели
+   * @param dashed Пунктир: 8 пикселей линии, 8 пикселей пропуска
+   ************************************************************/
+  void drawEdges(Color color, float width, bool dashed);
+
+  /************************************************************
+   * @brief Рисует все вершины модели
+   * @param size Размер вершины в пикселях
+   * @param round Круглые вершины, иначе квадратные
+   ************************************************************/
+  void drawVertices(Color color, float size, bool round);
+
+ private:
+  // Загрузка возвращает false, если модель не помещается в вызов отрисовки
+  bool uploadVertexes(const VertexArray& vertexes, bool append);
+  bool uploadEdges(const EdgeTable& edges);
+  bool uploadFaces(const FaceArray& faces, std::size_t vertex_count,
+                   bool append);
+  // Размеры передаются в GLsizeiptr: QOpenGLBuffer::allocate и write
+  // принимают int и не справляются с буферами больше 2 ГиБ
+  bool reserveBuffer(GLenum target, std::size_t& capacity, std::size_t needed,
+                     bool append);
+  void writeBuffer(GLenum target, std::size_t offset, const void* data,
+                   std::size_t size);
+  void dropModel();  // Забывает модель в буферах, следующая загрузка полная
+  void bindVertexes();
+  void releaseVertexes();
+
+  QOpenGLShaderProgram program_;
+  QOpenGLBuffer vertex_buffer_;
+  QOpenGLBuffer index_buffer_;
+  std::vector<GLuint> lines_;  // Индексы контуров при потоковой загрузке
+  std::size_t face_count_ = 0;  // Сколько полигонов уже в lines_
+  std::uint64_t revision_ = UINT64_MAX;
+  std::uint64_t rewrite_revision_ = UINT64_MAX;
+  bool streamed_ = false;  // Шла ли загрузка при прошлой синхронизации
+  GLsizei vertex_count_ = 0;
+  GLsizei index_count_ = 0;
+  std::size_t vertex_capacity_ = 0;  // Размер буферов в байтах
+  std::size_t index_capacity_ = 0;
+  bool ready_ = false;
+  bool legacy_ = false;  // Шейдеры GLSL 1.20, пунктир через glLineStipple
+};
+
+}  // namespace s21
+
+#endif  // MODEL_RENDERER_H
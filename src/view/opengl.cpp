@@ -1,10 +1,17 @@
 #include "opengl.h"
 
 #include <iostream>
+#include <vector>
 
-s21::OpenGl::OpenGl() : c{s21::Controller::getInstance()} {}
+s21::OpenGl::OpenGl() : c{s21::Controller::getInstance()} {
+  c.setTransformMode(TransformMode::kDeferred);
+}
 
-s21::OpenGl::~OpenGl() {}
+s21::OpenGl::~OpenGl() {
+  makeCurrent();
+  renderer.destroy();
+  doneCurrent();
+}
 
 void s21::OpenGl::setVerticesColor(const float& red, const float& green,
                                    const float& blue) {
@@ -22,76 +29,88 @@ void s21::OpenGl::setVetricesType(const int& type) { vertex_type = type; }
 void s21::OpenGl::initializeGL() {
   initializeOpenGLFunctions();
   glEnable(GL_DEPTH_TEST);
-  glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-  glMatrixMode(GL_PROJECTION);
-  glLoadIdentity();
+  renderer.initialize();
 }
 
 void s21::OpenGl::paintGL() {
-  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-  glMatrixMode(GL_MODELVIEW);
-  glLoadIdentity();
-
-  projection();
   glClearColor(background_color.red, background_color.green,
                background_color.blue, 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+  Matrix4 model = currentModel();
+  renderer.sync(c);
+
+  qreal ratio = devicePixelRatioF();
+  renderer.setTransform(projection() * model,
+                        static_cast<int>(width() * ratio),
+                        static_cast<int>(height() * ratio));
   if (vertex_type != 0) paintVertices();
 
   paintLine();
 }
 
 void s21::OpenGl::mouseMoveEvent(QMouseEvent* me) {
-  c.TransformModel(s21::RotateY, (me->pos().x() - mouse.x()) * 0.02);
-  c.TransformModel(s21::RotateX, (me->pos().y() - mouse.y()) * 0.02);
+  queueTransform(s21::RotateY, (me->pos().x() - mouse.x()) * 0.02);
+  queueTransform(s21::RotateX, (me->pos().y() - mouse.y()) * 0.02);
+}
+
+void s21::OpenGl::queueTransform(Movement move, double value) {
+  c.queueTransform(move, value);
   update();
 }
 
+void s21::OpenGl::discardTransforms() { c.discardQueuedTransforms(); }
+
+s21::Matrix4 s21::OpenGl::currentModel() {
+  c.applyQueuedTransforms();
+  Matrix4 model = c.modelMatrix();
+  // При загрузке вершины еще не нормализованы, а отложенные преобразования
+  // применяются к ним после нормализации
+  if (c.isStreaming()) {
+    model = model * c.pendingTransform() * streamingNormalization();
+  }
+  return model;
+}
+
+s21::RenderStyle s21::OpenGl::renderStyle() const {
+  RenderStyle style;
+  style.background = background_color;
+  style.line_color = line_color;
+  style.line_width = line_width;
+  style.dashed = !is_solid_line;
+  style.vertex_color = vertex_color;
+  if (vertex_type == 1) style.vertex_marker = VertexMarker::kRound;
+  if (vertex_type == 2) style.vertex_marker = VertexMarker::kSquare;
+  style.vertex_size = vertices_thickness * 2;
+  style.parallel_projection = is_parallel_projection;
+  return style;
+}
+
 void s21::OpenGl::mousePressEvent(QMouseEvent* me) { mouse = me->pos(); }
 
 void s21::OpenGl::paintVertices() {
-  glEnable(GL_BLEND);
-  if (vertex_type == 1) glEnable(GL_POINT_SMOOTH);
-  if (vertex_type == 2) glDisable(GL_POINT_SMOOTH);
-  glPointSize(vertices_thickness * 2);
-  glColor3f(vertex_color.red, vertex_color.green, vertex_color.blue);
-  auto& obj = c.getObject();
-  glBegin(GL_POINTS);
-  for (auto& v : obj.vertexes) {
-    glVertex3d(v.x, v.y, v.z);
-  }
-  glEnd();
+  renderer.drawVertices(vertex_color, vertices_thickness * 2,
+                        vertex_type == 1);
 }
 
 void s21::OpenGl::renderScene() { paintGL(); }
 
 void s21::OpenGl::paintLine() {
-  auto& obj = c.getObject();
-  auto& vertexes = obj.vertexes;
-  auto& lines = obj.lines;
-  glColor3f(line_color.red, line_color.green, line_color.blue);
-  for (auto& f : lines) {
-    glLineWidth(line_width);
-    if (is_solid_line) {
-      glDisable(GL_LINE_STIPPLE);
-      glBegin(GL_LINE_LOOP);
-    } else {
-      glLineStipple(1, 0x00ff);
-      glEnable(GL_LINE_STIPPLE);
-      glBegin(GL_LINE_LOOP);
-    }
-    for (auto& p : f.indexes) {
-      auto& point = vertexes.at(p - 1);
-      glVertex3d(point.x, point.y, point.z);
-    }
-    glEnd();
-  }
+  renderer.drawEdges(line_color, line_width, !is_solid_line);
 }
 
-void s21::OpenGl::projection() {
-  if (is_parallel_projection) {
-    glOrtho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
-  } else {
-    glFrustum(-0.5f, 0.5f, -0.5f, 0.5f, 0.1f, 100.f);
-    glTranslated(0, 0, -1.04);
-  }
+s21::Matrix4 s21::OpenGl::streamingNormalization() const {
+  const Bounds& bounds = c.streamingBounds();
+  if (bounds.empty()) return Matrix4();
+  double extent = bounds.extent();
+  double scale = extent > 0 ? 1 / extent : 1;
+  Point center = bounds.center();
+  return Matrix4::fromOperations({{MoveX, -center.x},
+                                  {MoveY, -center.y},
+                                  {MoveZ, -center.z},
+                                  {SCALE, scale}});
+}
+
+s21::Matrix4 s21::OpenGl::projection() const {
+  return projectionMatrix(is_parallel_projection);
 }
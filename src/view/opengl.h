@@ -5,14 +5,13 @@
 #include <QOpenGLFunctions>
 #include <QOpenGLWidget>
 #include <QWidget>
+#include <vector>
 
 #include "../controller/controller.h"
+#include "../render/rasterizer.hpp"
+#include "model_renderer.h"
 namespace s21 {
 
-struct Color {
-  float red, green, blue;
-};
-
 class OpenGl : public QOpenGLWidget, protected QOpenGLFunctions {
  public:
   OpenGl();
@@ -31,13 +30,23 @@ class OpenGl : public QOpenGLWidget, protected QOpenGLFunctions {
   void mousePressEvent(
       QMouseEvent* me) override;  // Реагирует на нажатие кнопок мыши
   void paintLine();
-  void projection();
+  Matrix4 projection() const;
+  Matrix4 streamingNormalization() const;  // Предварительная нормализация
+                                           // при потоковой загрузке
   void paintVertices();
 
  private:
   QPoint mouse;
+  ModelRenderer renderer;  // Модель в буферах видеопамяти
 
  public:
+  void queueTransform(Movement move, double value);  // Откладывает
+                                                     // преобразование до кадра,
+                                                     // кадр применяет пакетом
+  void discardTransforms();  // Сбрасывает отложенные преобразования
+  Matrix4 currentModel();  // Применяет отложенные преобразования и
+                           // возвращает матрицу модели кадра
+  RenderStyle renderStyle() const;  // Настройки отрисовки окна
   Color line_color{1.f, 1.f, 1.f};
   void renderScene();
   Color vertex_color{1.f, 1.f, 1.f};
@@ -1,12 +1,17 @@
 #include "view.h"
 
+#include <QFileInfo>
+#include <QMessageBox>
+#include <QStandardPaths>
+
 #include "ui_view.h"
 
 View::View(QWidget* parent)
     : QMainWindow(parent),
       ui(new Ui::View),
       wid(new s21::OpenGl),
-      timer(new QTimer) {
+      loadTimer(new QTimer),
+      exporter(new s21::ExportWorker) {
   ui->setupUi(this);
   setWindowTitle("3D_Viewer_v2.0");
 
@@ -19,16 +24,19 @@ View::View(QWidget* parent)
   wid->setGeometry(10, 10, 800, 800);
   wid->show();
   ui->opengl_layout->insertWidget(0, wid);
+  connect(loadTimer, SIGNAL(timeout()), this, SLOT(checkLoading()));
   loadSettings();
-  connect(timer, SIGNAL(timeout()), this, SLOT(add_qimage_in_gif()));
 }
 
 View::~View() {
+  turntable.reset();
+  delete exporter;  // Дописывает начатые файлы
+  wid->c.cancelLoading();
   saveSetting();
   delete ui;
   delete wid;
   delete settings;
-  delete timer;
+  delete loadTimer;
 }
 
 void View::on_solidLine_clicked() {
@@ -125,33 +133,73 @@ void View::on_OpenFile_clicked() {
   QFileDialog dialog(this);
   dialog.setFileMode(QFileDialog::ExistingFile);
   fileName = dialog.getOpenFileName(this, "Выбрать файл", "../", "*.obj");
-  auto& obj = wid->c.getObject();
   if (!fileName.isEmpty()) {
-    obj.vertexes.clear();
-    obj.lines.clear();
-    ui->dSBMoveX->setValue(0.00);
-    ui->dSBMoveY->setValue(0.00);
-    ui->dSBMoveZ->setValue(0.00);
-
-    ui->hRotate_x->setValue(0);
-    ui->hRotate_y->setValue(0);
-    ui->hRotate_z->setValue(0);
+    startLoading(fileName);
+  }
+}
 
-    ui->hScale->setValue(100);
+void View::startLoading(const QString& path) {
+  loadingFile = path;
+  if (QFileInfo(path).size() >= kStreamingThreshold) {
+    resetTransformControls();
+    wid->c.parseFileStreaming(path.toStdString(), cacheDirectory());
+    // Обратные сдвиги ползунков относятся к прежней модели
+    wid->discardTransforms();
+  } else {
+    wid->c.parseFileAsync(path.toStdString(), cacheDirectory());
+  }
+  ui->countVertAndEdges->setText("Loading...");
+  loadTimer->start(50);
+}
 
-    wid->c.parseFile(fileName.toStdString());
-    wid->c.Normalization();
+void View::checkLoading() {
+  auto& c = wid->c;
+  bool committed = false;
+  if (c.isStreaming()) {
+    committed = c.commitLoadedModel();
+    wid->update();
+  } else if (c.loadingState() == s21::LoadState::kFinished) {
+    resetTransformControls();
+    committed = c.commitLoadedModel();
+    wid->discardTransforms();
     wid->update();
-    ui->filePath_label->setText(fileName);
+    showLoadReport();
+  }
+
+  if (committed) {
+    loadTimer->stop();
+    ui->filePath_label->setText(loadingFile);
+    count_vetrexes_and_edges();
+  } else if (c.isStreaming() ||
+             c.loadingState() == s21::LoadState::kRunning) {
+    auto& progress = c.loadingProgress();
+    QString text{"Loading: "};
+    text += QString::number(progress.bytes / (1 << 20)) + " / " +
+            QString::number(progress.total_bytes / (1 << 20)) + " MB\n";
+    text += "Records: " + QString::number(progress.records);
+    ui->countVertAndEdges->setText(text);
+  } else {
+    loadTimer->stop();
     count_vetrexes_and_edges();
   }
 }
 
+void View::resetTransformControls() {
+  ui->dSBMoveX->setValue(0.00);
+  ui->dSBMoveY->setValue(0.00);
+  ui->dSBMoveZ->setValue(0.00);
+
+  ui->hRotate_x->setValue(0);
+  ui->hRotate_y->setValue(0);
+  ui->hRotate_z->setValue(0);
+
+  ui->hScale->setValue(100);
+}
+
 void View::on_hMove_x_valueChanged(int value) {
   static float last_val = 0.0;
-  wid->c.TransformModel(s21::MoveX, value / 100.0 - last_val);
+  wid->queueTransform(s21::MoveX, value / 100.0 - last_val);
   last_val = value / 100.0;
-  wid->update();
   ui->dSBMoveX->setValue(last_val);
 }
 
@@ -162,17 +210,15 @@ void View::on_dSBMoveX_valueChanged(double arg1) {
 
 void View::on_hMove_y_valueChanged(int value) {
   static float last_val = 0.0;
-  wid->c.TransformModel(s21::MoveY, value / 100.0 - last_val);
+  wid->queueTransform(s21::MoveY, value / 100.0 - last_val);
   last_val = value / 100.0;
-  wid->update();
   ui->dSBMoveY->setValue(last_val);
 }
 
 void View::on_hMove_z_valueChanged(int value) {
   static float last_val = 0.0;
-  wid->c.TransformModel(s21::MoveZ, value / 100.0 - last_val);
+  wid->queueTransform(s21::MoveZ, value / 100.0 - last_val);
   last_val = value / 100.0;
-  wid->update();
   ui->dSBMoveZ->setValue(last_val);
 }
 
@@ -188,17 +234,15 @@ void View::on_dSBMoveZ_valueChanged(double arg1) {
 
 void View::on_hRotate_x_valueChanged(int value) {
   static int last_val = 0;
-  wid->c.TransformModel(s21::RotateX, value - last_val);
+  wid->queueTransform(s21::RotateX, value - last_val);
   last_val = value;
-  wid->update();
   ui->sBRotateX->setValue(value);
 }
 
 void View::on_hRotate_y_valueChanged(int value) {
   static int last_val = 0;
-  wid->c.TransformModel(s21::RotateY, value - last_val);
+  wid->queueTransform(s21::RotateY, value - last_val);
   last_val = value;
-  wid->update();
   ui->sBRotateY->setValue(value);
 }
 
@@ -212,9 +256,8 @@ void View::on_sBRotateY_valueChanged(int arg1) {
 
 void View::on_hRotate_z_valueChanged(int value) {
   static int last_val = 0;
-  wid->c.TransformModel(s21::RotateZ, value - last_val);
+  wid->queueTransform(s21::RotateZ, value - last_val);
   last_val = value;
-  wid->update();
   ui->sBRotateZ->setValue(value);
 }
 
@@ -224,9 +267,8 @@ void View::on_sBRotateZ_valueChanged(int arg1) {
 
 void View::on_hScale_valueChanged(int value) {
   static double last_val = 1.0;
-  wid->c.TransformModel(s21::SCALE, value / 100.0 / last_val);
+  wid->queueTransform(s21::SCALE, value / 100.0 / last_val);
   last_val = static_cast<double>(value * 1.0 / 100);
-  wid->update();
   ui->dSBScale->setValue(last_val);
 }
 
@@ -331,23 +373,18 @@ void View::loadSettings() {
   ui->centralProjection->setChecked(!wid->is_parallel_projection);
   ui->filePath_label->setText(settings->value("filePath").toString());
   if (!ui->filePath_label->text().isEmpty()) {
-    wid->c.parseFile(ui->filePath_label->text().toStdString());
-    wid->c.Normalization();
-    count_vetrexes_and_edges();
+    startLoading(ui->filePath_label->text());
   }
 }
+std::string View::cacheDirectory() const {
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+      .toStdString();
+}
+
 void View::count_vetrexes_and_edges() {
   auto& obj = wid->c.getObject();
   int count_v = obj.vertexes.size();
-  int count_e = 0;
-  for (auto& f : obj.lines) {
-    int s = f.indexes.size();
-    if (s == 2) {
-      count_e += 1;
-    } else if (s > 2) {
-      count_e += s;
-    }
-  }
+  int count_e = obj.edges.size();
   QString v_str{"Vertexes: "};
   QString e_str{"Edges: "};
   v_str += QString::number(count_v) + "\n";
@@ -355,31 +392,132 @@ void View::count_vetrexes_and_edges() {
   ui->countVertAndEdges->setText(v_str + e_str);
 }
 
-void View::on_pngButton_clicked() {
-  wid->renderScene();
-  QImage image = wid->grabFramebuffer();
-  image.save("scene.jpeg");
+void View::showLoadReport() {
+  const s21::LoadReport& report = wid->c.loadReport();
+  QString text = report.cached ? "Cache: " : "Parse: ";
+  text += QString::number(report.parse_ms, 'f', 1) + " ms\n";
+  text += "Validate: " + QString::number(report.validate_ms, 'f', 1) +
+          " ms\n";
+  text += "Edges: " + QString::number(report.edges_ms, 'f', 1) + " ms\n";
+  if (report.cache_ms > 0) {
+    text += "Cache store: " + QString::number(report.cache_ms, 'f', 1) +
+            " ms\n";
+  }
+  text += "Normalize: " + QString::number(report.normalize_ms, 'f', 1) +
+          " ms\n";
+  text += "Total: " + QString::number(report.total_ms, 'f', 1) + " ms\n";
+  text += "Faces: " + QString::number(report.faces) + ", indexes: " +
+          QString::number(report.indexes);
+  const s21::FaceValidation& validation = report.validation;
+  if (!validation.clean()) {
+    text += "\nInvalid indexes: " +
+            QString::number(validation.invalid_indexes) +
+            ", repaired faces: " + QString::number(validation.repaired_faces) +
+            ", rejected faces: " + QString::number(validation.rejected_faces);
+  }
+  ui->countVertAndEdges->setToolTip(text);
 }
 
-void View::on_bmpButton_clicked() {
+void View::on_pngButton_clicked() { saveScreenshot("scene.jpeg"); }
+
+void View::on_bmpButton_clicked() { saveScreenshot("scene.bmp"); }
+
+void View::saveScreenshot(const QString& file) {
   wid->renderScene();
+  // QImage разделяет данные со счетчиком ссылок, поэтому копия в задаче
+  // не копирует пиксели, а кодирование идет в потоке экспорта
   QImage image = wid->grabFramebuffer();
-  image.save("scene.bmp");
+  s21::ExportTask task{[image, file] { return image.save(file); },
+                       exportCallback(file)};
+  // Очередь может быть занята записью GIF, и ждать ее в потоке интерфейса
+  // нельзя: снимок не ставится, а пользователь узнает об этом
+  if (!exporter->trySubmit(task)) {
+    QMessageBox::information(this, "Export",
+                             "Export queue is busy, " + file +
+                                 " was not saved. Try again later.");
+  }
 }
 
 void View::on_gifButton_clicked() {
-  gif = new QGifImage();
-  gif->setDefaultDelay(33);
-  timer->setInterval(33);
-  timer->start();
-}
-
-void View::add_qimage_in_gif() {
-  QImage image = wid->grabFramebuffer().scaled(640, 480);
-  gif->addFrame(image);
-  if (gif->frameCount() == 5 * 30) {
-    gif->save("scene.gif");
-    delete gif;
-    timer->stop();
+  if (turntable) return;
+  // Кадры рисуются программно с постоянным шагом поворота, поэтому
+  // анимация не зависит от частоты кадров окна и действий пользователя
+  s21::TurntableSettings animation;
+  animation.style = wid->renderStyle();
+  // Запись идет по копии вершин и ребер, поэтому модель можно загружать и
+  // преобразовывать, пока пишется анимация
+  const s21::Object& object = wid->c.getObject();
+  s21::Object snapshot;
+  snapshot.vertexes = object.vertexes;
+  if (object.edges.empty()) {
+    snapshot.edges.build(object.lines, object.vertexes.size());
+  } else {
+    snapshot.edges = object.edges;
+  }
+  turntable = std::make_unique<s21::Turntable>(
+      std::move(snapshot), wid->currentModel(), animation);
+  gifWriter = std::make_shared<s21::GifWriter>();
+  gifStep = 0;
+  gifTask = {};
+  ui->gifButton->setEnabled(false);
+  recordGifFrame();
+}
+
+void View::recordGifFrame() {
+  // Задачи записи ставятся без ожидания. Если очередь экспорта полна,
+  // готовая задача остается в gifTask, а попытку повторит завершение
+  // любой задачи из очереди: кадры не теряются, и поток интерфейса не
+  // ждет и не опрашивает очередь
+  if (!gifWriter) return;
+  if (!gifTask.run) gifTask = nextGifTask();
+  if (!exporter->trySubmit(gifTask)) return;
+  gifTask = {};
+  if (++gifStep <= turntable->frameCount() + 1) {
+    // Между кадрами поток интерфейса успевает обработать события
+    QTimer::singleShot(0, this, &View::recordGifFrame);
+    return;
+  }
+  turntable.reset();
+  gifWriter.reset();
+}
+
+s21::ExportTask View::nextGifTask() {
+  auto retry = [this](bool) {
+    QMetaObject::invokeMethod(
+        this, [this] { recordGifFrame(); }, Qt::QueuedConnection);
+  };
+  const s21::TurntableSettings& animation = turntable->settings();
+  if (gifStep == 0) {
+    return {[writer = gifWriter, animation] {
+              return writer->open("scene.gif", animation.width,
+                                  animation.height, animation.delay_ms);
+            },
+            retry};
   }
+  if (gifStep <= turntable->frameCount()) {
+    s21::Image image;
+    turntable->renderFrame(gifStep - 1, image);
+    return {[writer = gifWriter, image = std::move(image)] {
+              return writer->addFrame(image);
+            },
+            retry};
+  }
+  // Ошибка записи кадра закрывает файл, и close возвращает false
+  return {[writer = gifWriter] { return writer->close(); },
+          exportCallback("scene.gif")};
+}
+
+std::function<void(bool)> View::exportCallback(const QString& file) {
+  return [this, file](bool ok) {
+    QMetaObject::invokeMethod(
+        this, [this, file, ok] { exportFinished(file, ok); },
+        Qt::QueuedConnection);
+  };
+}
+
+void View::exportFinished(const QString& file, bool ok) {
+  if (file == "scene.gif") ui->gifButton->setEnabled(true);
+  // Освободилось место в очереди, которого могла ждать запись GIF
+  recordGifFrame();
+  if (!ok) QMessageBox::warning(this, "Export", "Could not write " + file);
 }
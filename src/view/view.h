@@ -1,13 +1,15 @@
 #ifndef VIEW_H
 #define VIEW_H
 
-#include <qgifimage.h>
-
 #include <QFileDialog>
 #include <QMainWindow>
 #include <QSettings>
 #include <QTimer>
+#include <memory>
 
+#include "../concurrency/export_worker.hpp"
+#include "../render/gif_writer.hpp"
+#include "../render/turntable.hpp"
 #include "opengl.h"
 
 QT_BEGIN_NAMESPACE
@@ -97,7 +99,9 @@ class View : public QMainWindow {
 
   void on_gifButton_clicked();
 
-  void add_qimage_in_gif();
+  void recordGifFrame();
+
+  void checkLoading();
 
   void saveSetting();
   void loadSettings();
@@ -106,11 +110,28 @@ class View : public QMainWindow {
   void loadBackgroundSettings();
 
  private:
+  std::string cacheDirectory() const;
+  void startLoading(const QString &path);
+  void resetTransformControls();
+  void showLoadReport();  // Времена этапов загрузки во всплывающей подсказке
+  void saveScreenshot(const QString &file);
+  std::function<void(bool)> exportCallback(const QString &file);
+  void exportFinished(const QString &file, bool ok);
+  s21::ExportTask nextGifTask();  // Открытие, кадр или закрытие GIF
+
+  // Файлы от этого размера показываются по мере загрузки
+  static constexpr qint64 kStreamingThreshold = qint64{64} << 20;
+
   Ui::View *ui;
   s21::OpenGl *wid;
-  QTimer *timer;
-  QGifImage *gif;
+  QTimer *loadTimer;
+  s21::ExportWorker *exporter;  // Кодирование и запись файлов в фоне
+  std::unique_ptr<s21::Turntable> turntable;  // Идущая запись GIF
+  std::shared_ptr<s21::GifWriter> gifWriter;
+  int gifStep = 0;  // 0 - открытие, 1..frames - кадры, затем закрытие
+  s21::ExportTask gifTask;  // Задача, для которой не было места в очереди
   QString fileName;
+  QString loadingFile;
   QSettings *settings;
 };
 #endif  // VIEW_H
@@ -8,24 +8,77 @@ CONFIG += c++17
 # In order to do so, uncomment the following line.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
-include(QtGifImage/src/gifimage/qtgifimage.pri)
+# Store vertex coordinates as float to halve the memory taken by large models.
+DEFINES += S21_FLOAT32_VERTICES
+
+include(QtGifImage/src/3rdParty/giflib.pri)
+
+# PNG compression.
+LIBS += -lz
 
 SOURCES += \
     main.cpp \
+    model_renderer.cpp \
     opengl.cpp \
     view.cpp \
+    ../cache/model_cache.cpp \
+    ../concurrency/export_worker.cpp \
+    ../concurrency/thread_pool.cpp \
+    ../loader/async_loader.cpp \
+    ../loader/load_pipeline.cpp \
     ../manipulation/manipulation.cpp \
+    ../object/edge_table.cpp \
+    ../object/face_array.cpp \
     ../object/object.cpp \
+    ../object/vertex_array.cpp \
+    ../parser/mapped_file.cpp \
     ../parser/parser.cpp \
+    ../parser/tokenizer.cpp \
+    ../render/gif_writer.cpp \
+    ../render/image.cpp \
+    ../render/png_writer.cpp \
+    ../render/rasterizer.cpp \
+    ../render/turntable.cpp \
+    ../transformation/axis_transform.cpp \
+    ../transformation/execution.cpp \
+    ../transformation/kernels.cpp \
+    ../transformation/kernels_avx2.cpp \
+    ../transformation/kernels_avx512.cpp \
+    ../transformation/kernels_sse2.cpp \
+    ../transformation/matrix.cpp \
     ../transformation/transformation.cpp \
 
 HEADERS += \
+    model_renderer.h \
     opengl.h \
     view.h \
+    ../cache/model_cache.hpp \
+    ../concurrency/bounded_queue.hpp \
+    ../concurrency/export_worker.hpp \
+    ../concurrency/thread_pool.hpp \
     ../controller/controller.h \
+    ../loader/async_loader.hpp \
+    ../loader/load_pipeline.hpp \
     ../manipulation/manipulation.hpp \
+    ../object/edge_table.hpp \
+    ../object/face_array.hpp \
     ../object/object.hpp \
+    ../object/point.hpp \
+    ../object/vertex_array.hpp \
+    ../parser/directives.hpp \
+    ../parser/mapped_file.hpp \
     ../parser/parser.hpp \
+    ../parser/tokenizer.hpp \
+    ../render/gif_writer.hpp \
+    ../render/image.hpp \
+    ../render/png_writer.hpp \
+    ../render/rasterizer.hpp \
+    ../render/turntable.hpp \
+    ../transformation/axis_transform.hpp \
+    ../transformation/execution.hpp \
+    ../transformation/kernels.hpp \
+    ../transformation/kernels_impl.hpp \
+    ../transformation/matrix.hpp \
     ../transformation/transformation.hpp \
 
 FORMS += \